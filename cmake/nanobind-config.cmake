@@ -217,6 +217,7 @@ function (nanobind_build_library TARGET_NAME)
     ${NB_DIR}/src/nb_enum.cpp
     ${NB_DIR}/src/nb_ndarray.cpp
     ${NB_DIR}/src/nb_static_property.cpp
+    ${NB_DIR}/src/nb_member.cpp
     ${NB_DIR}/src/nb_datetime.cpp
     ${NB_DIR}/src/nb_ft.h
     ${NB_DIR}/src/common.cpp
@@ -303,6 +304,12 @@ function (nanobind_build_library TARGET_NAME)
   endif()
   target_link_libraries(${TARGET_NAME} PRIVATE tsl::robin_map)
 
+  # Parallel array copies (nb_ndarray.cpp) create threads
+  if (NOT WIN32)
+    find_package(Threads REQUIRED)
+    target_link_libraries(${TARGET_NAME} PRIVATE Threads::Threads)
+  endif()
+
   target_include_directories(${TARGET_NAME} ${AS_SYSINCLUDE} PUBLIC
     ${Python_INCLUDE_DIRS}
     ${NB_DIR}/include)
@@ -125,6 +125,8 @@ struct is_generic {};
 struct kw_only {};
 struct lock_self {};
 struct never_destruct {};
+struct no_identity {};
+struct cache_overloads {};
 
 struct pooled {
     explicit pooled(uint32_t capacity = 128) : capacity(capacity) {}
@@ -132,6 +134,7 @@ struct pooled {
 };
 
 template <size_t /* Nurse */, size_t /* Patient */> struct keep_alive {};
+template <size_t /* Axis */, size_t... /* Args */> struct same_extent {};
 template <typename T> struct supplement {};
 template <typename T> struct intrusive_ptr {
     intrusive_ptr(void (*set_self_py)(T *, PyObject *) noexcept)
@@ -251,6 +254,11 @@ NB_INLINE void func_extra_apply(F &, kw_only, size_t &) {}
 template <typename F>
 NB_INLINE void func_extra_apply(F &, lock_self, size_t &) {}
 
+template <typename F>
+NB_INLINE void func_extra_apply(F &f, cache_overloads, size_t &) {
+    f.flags |= (uint32_t) func_flags::cache_overloads;
+}
+
 template <typename F, typename... Ts>
 NB_INLINE void func_extra_apply(F &, call_guard<Ts...>, size_t &) {}
 
@@ -259,6 +267,9 @@ NB_INLINE void func_extra_apply(F &f, nanobind::keep_alive<Nurse, Patient>, size
     f.flags |= (uint32_t) func_flags::can_mutate_args;
 }
 
+template <typename F, size_t Axis, size_t... Is>
+NB_INLINE void func_extra_apply(F &, nanobind::same_extent<Axis, Is...>, size_t &) {}
+
 template <typename F, typename Policy>
 NB_INLINE void func_extra_apply(F &f, call_policy<Policy>, size_t &) {
     f.flags |= (uint32_t) func_flags::can_mutate_args;
@@ -268,6 +279,7 @@ template <typename... Ts> struct func_extra_info {
     using call_guard = void;
     static constexpr bool pre_post_hooks = false;
     static constexpr size_t nargs_locked = 0;
+    static constexpr size_t extent_words = 0;
     static constexpr bool has_policy = false;
     static constexpr rv_policy::value policy = rv_policy::automatic_v;
 };
@@ -296,6 +308,14 @@ struct func_extra_info<nanobind::keep_alive<Nurse, Patient>, Ts...> : func_extra
     static constexpr bool pre_post_hooks = true;
 };
 
+template <size_t Axis, size_t... Is, typename... Ts>
+struct func_extra_info<nanobind::same_extent<Axis, Is...>, Ts...> : func_extra_info<Ts...> {
+    static_assert(sizeof...(Is) >= 2,
+                  "same_extent<> requires at least two arguments");
+    static constexpr size_t extent_words =
+        2 + sizeof...(Is) + func_extra_info<Ts...>::extent_words;
+};
+
 template <typename Policy, typename... Ts>
 struct func_extra_info<call_policy<Policy>, Ts...> : func_extra_info<Ts...> {
     static constexpr bool pre_post_hooks = true;
@@ -30,7 +30,8 @@
 
     - exceptions: ``python_error``, ``builtin_exception``.
     - trampolines: ``trampoline``, ``ticket``.
-    - ND-arrays: ``ndarray_config``, ``ndarray_create_args``.
+    - ND-arrays: ``ndarray_config``, ``ndarray_create_args``,
+      ``ndarray_import_entry``.
 
     Copyright (c) 2022 Wenzel Jakob
 
@@ -44,7 +45,7 @@
 
 /// Minor version of the backend ABI. Advances after ABI-compatible changes
 /// (appending flag-gated fields, adding enum bits, etc.).
-#define NB_BACKEND_ABI_MINOR 0
+#define NB_BACKEND_ABI_MINOR 1
 
 /// Patch revision signaling internal improvements without effect on the ABI
 /// contract. Together with the ABI macros above, it forms the version of the
@@ -120,9 +121,11 @@ NAMESPACE_BEGIN(detail)
 
 struct ndarray_handle;
 struct ndarray_config;
+struct ndarray_import_entry;
 struct ndarray_create_args;
 struct ticket;
 struct import_cache;
+struct type_cache;
 
 /// Opaque record holding the backend state of one domain
 struct nb_internals;
@@ -146,7 +149,17 @@ extern nb_internals *nb_ctx_unavailable() noexcept;
 /// Backend configuration flags accessed via read_flag/write_flag.
 enum class nb_flag : uint32_t {
     leak_warnings = 0,
-    implicit_cast_warnings = 1
+    implicit_cast_warnings = 1,
+
+    // Parallel copies in ndarray conversions (ABI minor 1)
+    ndarray_copy_threads = 2,
+    ndarray_copy_threshold = 3,
+
+    // Reuse of exported ndarray objects (ABI minor 1)
+    ndarray_export_cache = 4,
+
+    // Lock statistics of the instance shards (ABI minor 1)
+    shard_stats = 5
 };
 
 /// Types of the Python 'datetime' module handled by the 'datetime_unpack'
@@ -234,11 +247,15 @@ enum class func_flags : uint32_t {
     /// Is this overload a copy constructor? The dispatcher then never
     /// raises the call-wide 'convert' flag: implicit conversion of the
     /// source argument would recurse infinitely
-    is_copy_constructor = (1 << 14)
+    is_copy_constructor = (1 << 14),
+
+    /// Should the dispatcher memoize the outcome of overload resolution per
+    /// argument type signature? (nb::cache_overloads)
+    cache_overloads = (1 << 15)
 };
 
 /// Public flags characterizing type objects. Their values are frozen by the
-/// ABI contract. Bits 14..18 are free, bits 19..23 belong to ``type_init_flags``
+/// ABI contract. Bits 15..18 are free, bits 19..23 belong to ``type_init_flags``
 /// below, and bits 24..31 hold the ABI tag.
 enum class type_flags : uint32_t {
     /// Does the type provide a C++ destructor?
@@ -282,7 +299,12 @@ enum class type_flags : uint32_t {
     is_generic               = (1 << 12),
 
     /// Does the type opt into instance pooling? (nb::pooled)
-    pooled                   = (1 << 13)
+    pooled                   = (1 << 13),
+
+    /// Instances are not tracked in the C++ -> Python instance map, so that
+    /// returning a C++ object by reference always creates a new wrapper
+    /// (nb::no_identity)
+    no_identity              = (1 << 14)
 };
 
 /// Flags about a type that are only relevant when it is being created.
@@ -321,6 +343,23 @@ enum class enum_flags : uint32_t {
     is_str                 = (1 << 4)
 };
 
+/// Flags characterizing a field served by the 'member_install' slot. Bits
+/// 0..7 hold the size of the field in bytes.
+enum class member_flags : uint32_t {
+    /// Is the field a signed integer (or an enumeration with a signed
+    /// underlying type)?
+    is_signed                = (1 << 8),
+
+    /// Is the field a floating point value ('float' or 'double')?
+    is_float                 = (1 << 9),
+
+    /// Is the field a 'bool'?
+    is_bool                  = (1 << 10),
+
+    /// Is the field an enumeration? (bound via nb::enum_<T>)
+    is_enum                  = (1 << 11)
+};
+
 /**
  * Helper class to clean temporaries created by function dispatch. Entry 0
  * stores the 'self' object of method calls for rv_policy::reference_internal.
@@ -589,5 +589,175 @@ NB_SLOT_ALIAS(PyObject *, vectorcall_method,
                PyObject *kwnames),
               PyObject_VectorcallMethod)
 
+// --------------------------------------------------------------------------
+// Member descriptors (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Variant of 'property_install' for a scalar field of the instances of
+/// 'scope'. The installed descriptor reads and writes the field directly, and
+/// only calls 'getter' and 'setter' to handle errors. 'member' points to the
+/// 'member_size' bytes of the C++ member pointer designating the field (at
+/// most 16). The descriptor copies them and calls 'offset' with the first
+/// instance it accesses to obtain the byte offset of the field. 'flags'
+/// characterizes the field (see 'member_flags'), and 'type' names the C++
+/// type of enumeration fields.
+NB_SLOT(void, member_install,
+        (nb_internals *p, PyObject *scope, const char *name, PyObject *getter,
+         PyObject *setter, const void *member, size_t member_size,
+         size_t (*offset)(const void *inst, const void *member),
+         uint32_t flags, const std::type_info *type) noexcept)
+
+// --------------------------------------------------------------------------
+// Batch instance creation (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Batch variant of 'nb_type_put' that converts the 'n' instances of
+/// 'cpp_type' at 'values', 'values + stride', etc., writing new references to
+/// 'out'. The 'copy' and 'move' policies draw from the instance pool and
+/// update 'inst_c2p' in bulk, other policies convert each element separately.
+/// Returns false on failure, in which case the entries of 'out' written by
+/// this function have been released and reset to null.
+NB_SLOT(bool, nb_type_put_n,
+        (nb_internals *p, const std::type_info *cpp_type, void *values,
+         size_t stride, size_t n, rv_policy rvp, cleanup_list *cleanup,
+         PyObject **out) noexcept)
+
+// --------------------------------------------------------------------------
+// Instance pool statistics (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Return a dictionary with the instance pool counters of the nanobind type
+/// 't' of the caller's domain (hits, misses, evictions, grows, shrinks) and
+/// the capacity and size of the calling thread's pool. Returns nullptr and
+/// sets a Python error on failure.
+NB_SLOT(PyObject *, nb_type_pool_stats, (nb_internals *p, PyObject *t) noexcept)
+
+// --------------------------------------------------------------------------
+// Bulk scalar conversions (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Bulk variants of the 'load_*' slots that convert the 'n' objects 'items'
+/// into 'out[0..n)'. Returns the index of the first object that could not be
+/// converted, or 'n' on success.
+NB_SLOT(size_t, load_i8_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         int8_t *out) noexcept)
+NB_SLOT(size_t, load_u8_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         uint8_t *out) noexcept)
+NB_SLOT(size_t, load_i16_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         int16_t *out) noexcept)
+NB_SLOT(size_t, load_u16_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         uint16_t *out) noexcept)
+NB_SLOT(size_t, load_i32_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         int32_t *out) noexcept)
+NB_SLOT(size_t, load_u32_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         uint32_t *out) noexcept)
+NB_SLOT(size_t, load_i64_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         int64_t *out) noexcept)
+NB_SLOT(size_t, load_u64_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         uint64_t *out) noexcept)
+NB_SLOT(size_t, load_f32_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         float *out) noexcept)
+NB_SLOT(size_t, load_f64_n,
+        (nb_internals *p, PyObject **items, size_t n, uint32_t flags,
+         double *out) noexcept)
+
+/// Convert a one-dimensional object implementing the buffer protocol into an
+/// array of scalars of the given 'kind' ('i', 'u', or 'f') and byte 'size'.
+/// Calls 'resize(target, n)' to obtain storage for the 'n' elements, which
+/// may return nullptr to reject the size. Returns false without raising when
+/// 'o' is not such an object, when its elements cannot be converted
+/// losslessly (e.g., out-of-range integers), or when 'flags' lacks
+/// 'cast_flags::convert'. The caller should then use the sequence protocol.
+NB_SLOT(bool, load_buffer,
+        (nb_internals *p, PyObject *o, char kind, size_t size, uint32_t flags,
+         void *(*resize)(void *target, size_t n) noexcept,
+         void *target) noexcept)
+
+/// Inverse of 'load_buffer': create a list (or a tuple if 'tuple' is set) of
+/// the 'n' scalars of the given 'kind' ('i', 'u', or 'f') and byte 'size' at
+/// 'data'. Returns null with an error set on failure.
+NB_SLOT(PyObject *, seq_from_buffer,
+        (const void *data, size_t n, char kind, size_t size,
+         bool tuple) noexcept)
+
+// --------------------------------------------------------------------------
+// Memory-mapped arrays (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Map 'size' bytes of a file starting at byte 'offset' into memory. The file
+/// is given by 'path', or by the file descriptor 'fd' when 'path' is null.
+/// 'mode' is a value of 'mmap_mode'. Returns a capsule that unmaps the region
+/// when it expires and stores the address in '*data', or null with an error
+/// set.
+NB_SLOT(PyObject *, ndarray_mmap,
+        (const char *path, int fd, uint64_t offset, size_t size,
+         uint32_t mode, void **data) noexcept)
+
+// --------------------------------------------------------------------------
+// Aligned array storage (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Allocate 'size' bytes aligned to 'alignment' (a power of two). 'flags' is
+/// a combination of 'alloc_flags'. Returns a capsule that releases the memory
+/// when it expires and stores the address in '*data', or null with an error
+/// set.
+NB_SLOT(PyObject *, ndarray_alloc,
+        (nb_internals *p, size_t size, size_t alignment, uint32_t flags,
+         void **data) noexcept)
+
+// --------------------------------------------------------------------------
+// Batched ndarray import (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Import the 'n' array arguments of one call. Consecutive arguments of the
+/// same type share the type and '__dlpack__' lookups. 'links' lists groups of
+/// arguments that must have the same extent along one dimension, each encoded
+/// as '[axis, count, entry_0, ..., entry_{count-1}]' ('nlinks' words in
+/// total). When 'remember' is set, converted arrays replace the entry's
+/// source object. Returns false and releases all imported arrays when an
+/// argument is incompatible.
+NB_SLOT(bool, ndarray_import_n,
+        (nb_internals *p, ndarray_import_entry *e, size_t n,
+         const uint32_t *links, size_t nlinks, bool remember,
+         cleanup_list *cleanup) noexcept)
+
+// --------------------------------------------------------------------------
+// Cached type lookups (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Variant of 'nb_type_get' that memoizes the type record of 't' in the
+/// frontend-owned cache 'c'. 'td' is the record found valid by the caller
+/// (or nullptr, in which case the backend looks it up and fills 'c').
+NB_SLOT(bool, nb_type_get_cached,
+        (nb_internals *p, const std::type_info *t, type_cache *c, void *td,
+         PyObject *o, uint32_t flags, cleanup_list *cleanup,
+         void **out) noexcept)
+
+/// Variant of 'nb_type_put' that memoizes the type record of 'cpp_type' in
+/// the frontend-owned cache 'c'. 'td' works as in 'nb_type_get_cached'.
+NB_SLOT(PyObject *, nb_type_put_cached,
+        (nb_internals *p, const std::type_info *cpp_type,
+         const std::type_info *cpp_type_p, type_cache *c, void *td,
+         void *value, rv_policy rvp, cleanup_list *cleanup,
+         bool *is_new) noexcept)
+
+// --------------------------------------------------------------------------
+// Shard statistics (ABI minor 1)
+// --------------------------------------------------------------------------
+
+/// Return a dictionary with the shard count of the caller's domain and, per
+/// shard, the number of lock acquisitions and of those that had to wait.
+/// Returns nullptr and sets a Python error on failure.
+NB_SLOT(PyObject *, nb_shard_stats, (nb_internals *p) noexcept)
+
 #undef NB_SLOT
 #undef NB_SLOT_ALIAS
@@ -175,6 +175,48 @@ struct type_caster<T, enable_if_t<std::is_arithmetic_v<T> && !is_std_char_v<T>>>
         }
     }
 
+    /// Kind of the scalar type for the 'load_buffer' slot
+    static constexpr char buffer_kind =
+        std::is_floating_point_v<T> ? 'f' : (std::is_signed_v<T> ? 'i' : 'u');
+
+    /// Convert the 'n' objects 'items' into 'out[0..n)'. Returns the index of
+    /// the first object that could not be converted, or 'n' on success.
+    NB_INLINE static size_t from_python_n(PyObject **items, size_t n,
+                                          uint32_t flags, cleanup_list *cleanup,
+                                          T *out) noexcept {
+        if constexpr (std::is_same_v<T, double>) {
+            return NB_CALL(load_f64_n)(NB_CTX_C(cleanup), items, n, flags, out);
+        } else if constexpr (std::is_same_v<T, float>) {
+            return NB_CALL(load_f32_n)(NB_CTX_C(cleanup), items, n, flags, out);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            type_caster caster;
+            for (size_t i = 0; i < n; ++i) {
+                if (!caster.from_python(items[i], flags, cleanup))
+                    return i;
+                out[i] = caster.value;
+            }
+            return n;
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 8)
+                return NB_CALL(load_i64_n)(NB_CTX_C(cleanup), items, n, flags, (int64_t *) out);
+            else if constexpr (sizeof(T) == 4)
+                return NB_CALL(load_i32_n)(NB_CTX_C(cleanup), items, n, flags, (int32_t *) out);
+            else if constexpr (sizeof(T) == 2)
+                return NB_CALL(load_i16_n)(NB_CTX_C(cleanup), items, n, flags, (int16_t *) out);
+            else
+                return NB_CALL(load_i8_n)(NB_CTX_C(cleanup), items, n, flags, (int8_t *) out);
+        } else {
+            if constexpr (sizeof(T) == 8)
+                return NB_CALL(load_u64_n)(NB_CTX_C(cleanup), items, n, flags, (uint64_t *) out);
+            else if constexpr (sizeof(T) == 4)
+                return NB_CALL(load_u32_n)(NB_CTX_C(cleanup), items, n, flags, (uint32_t *) out);
+            else if constexpr (sizeof(T) == 2)
+                return NB_CALL(load_u16_n)(NB_CTX_C(cleanup), items, n, flags, (uint16_t *) out);
+            else
+                return NB_CALL(load_u8_n)(NB_CTX_C(cleanup), items, n, flags, (uint8_t *) out);
+        }
+    }
+
     NB_INLINE static handle from_cpp(T src, rv_policy, cleanup_list *) noexcept {
         if constexpr (std::is_floating_point_v<T>) {
             return PyFloat_FromDouble((double) src);
@@ -491,6 +533,46 @@ template <typename T> NB_INLINE rv_policy infer_policy(rv_policy policy) {
 
 template <typename T, typename SFINAE = int> struct type_hook : std::false_type { };
 
+/// Type record of a bound type memoized by the 'nb_type_get_cached' and
+/// 'nb_type_put_cached' slots. The backend fills the record, and the caster
+/// reuses 'td' while 'epoch' matches the domain epoch at 'epoch_ptr'.
+struct type_cache {
+    uint32_t epoch;
+    uint32_t busy;
+    void *td;
+    const uint32_t *epoch_ptr;
+};
+
+/// Epoch of records that were never filled (never matches, see below)
+NB_HIDDEN inline const uint32_t type_cache_none = 0;
+
+/// One cache per bound type and extension
+template <typename T>
+NB_HIDDEN inline type_cache type_cache_v { 0, 0, nullptr, &type_cache_none };
+
+/// Return the type record memoized in 'c', or nullptr if it is stale. Empty
+/// records compare equal to 'type_cache_none' but hold no type record.
+NB_INLINE void *type_cache_get(const type_cache &c) noexcept {
+#if defined(NB_FREE_THREADED)
+    // Seqlock read (the backend's nb_type_c2p_cached() is the writer)
+    using epoch_t = const std::atomic<uint32_t>;
+    epoch_t &epoch = *(epoch_t *) &c.epoch;
+    uint32_t value = epoch.load(std::memory_order_acquire);
+    void *td = ((const std::atomic<void *> *) &c.td)
+                   ->load(std::memory_order_relaxed);
+    epoch_t *epoch_ptr = (epoch_t *) ((const std::atomic<const uint32_t *> *)
+                                          &c.epoch_ptr)
+                             ->load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (NB_LIKELY(epoch.load(std::memory_order_relaxed) == value &&
+                  epoch_ptr->load(std::memory_order_relaxed) == value))
+        return td;
+    return nullptr;
+#else
+    return *c.epoch_ptr == c.epoch ? c.td : nullptr;
+#endif
+}
+
 template <typename Type_> struct type_caster_base : type_caster_base_tag {
     using Type = Type_;
     static constexpr auto Name = const_name<Type>();
@@ -502,8 +584,10 @@ template <typename Type_> struct type_caster_base : type_caster_base_tag {
         // only one that is ever trusted) and, as a fallback, in nb_type_get.
         // The generic base caster therefore need not test for it here, which
         // would only add a never-taken branch to every bound-type argument.
-        return NB_CALL(nb_type_get)(NB_CTX_C(cleanup), &typeid(Type), src.ptr(),
-                                    flags, cleanup, (void **) &value);
+        type_cache &c = type_cache_v<Type>;
+        return NB_CALL(nb_type_get_cached)(NB_CTX_C(cleanup), &typeid(Type),
+                                           &c, type_cache_get(c), src.ptr(),
+                                           flags, cleanup, (void **) &value);
     }
 
     template <typename T>
@@ -527,8 +611,16 @@ template <typename Type_> struct type_caster_base : type_caster_base_tag {
         if constexpr (std::is_polymorphic_v<Type>)
             type_p = (!has_type_hook && ptr) ? &typeid(*ptr) : nullptr;
 
-        return NB_CALL(nb_type_put)(NB_CTX_C(cleanup), type, type_p, ptr, policy,
-                                    cleanup, nullptr);
+        // The hook may name a different type on every call (no caching)
+        if constexpr (has_type_hook) {
+            return NB_CALL(nb_type_put)(NB_CTX_C(cleanup), type, type_p, ptr,
+                                        policy, cleanup, nullptr);
+        } else {
+            type_cache &c = type_cache_v<Type>;
+            return NB_CALL(nb_type_put_cached)(NB_CTX_C(cleanup), type, type_p,
+                                               &c, type_cache_get(c), ptr,
+                                               policy, cleanup, nullptr);
+        }
     }
 
     template <typename T_>
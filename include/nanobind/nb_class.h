@@ -56,6 +56,10 @@ NB_INLINE void type_extra_apply(type_data_init &, never_destruct) {
     // intentionally empty
 }
 
+NB_INLINE void type_extra_apply(type_data_init &t, no_identity) {
+    t.flags |= (uint32_t) type_flags::no_identity;
+}
+
 NB_INLINE void type_extra_apply(type_data_init &t, pooled p) {
     t.flags |= (uint32_t) type_flags::pooled;
     t.pool_capacity = p.capacity;
@@ -151,6 +155,12 @@ inline const std::type_info& type_info(handle h) { return *NB_CALL(nb_type_info)
 template <typename T>
 inline T &type_supplement(handle h) { return *(T *) NB_CALL(nb_type_supplement)(h.ptr()); }
 inline str type_name(handle h) { return steal<str>(NB_CALL(nb_type_name)(h.ptr())); }
+inline dict type_pool_stats(handle h) {
+    PyObject *result = NB_CALL(nb_type_pool_stats)(NB_CTX, h.ptr());
+    if (!result)
+        detail::raise_python_error();
+    return steal<dict>(result);
+}
 
 // Low level access to arbitrary Python type objects and instances
 inline dict type_dict(handle h) noexcept {
@@ -424,6 +434,58 @@ namespace detail {
     template <typename T> auto filter_setter(const T &v) { return v; }
     template <typename T> auto filter_setter(const for_setter<T> &v) { return v.value; }
     template <typename T> std::nullptr_t filter_setter(const for_getter<T> &) { return nullptr; }
+
+    /// Flags describing a field of type 'D' to the 'member_install' slot, or
+    /// zero if def_rw()/def_ro() must bind the field via getter and setter.
+    template <typename D> constexpr uint32_t member_flags_for() {
+        constexpr uint32_t size = (uint32_t) sizeof(D);
+        if constexpr (std::is_same_v<D, bool>) {
+            return (uint32_t) member_flags::is_bool | size;
+        } else if constexpr (std::is_enum_v<D>) {
+            return (uint32_t) member_flags::is_enum | size |
+                   (std::is_signed_v<std::underlying_type_t<D>>
+                        ? (uint32_t) member_flags::is_signed : 0u);
+        } else if constexpr (std::is_same_v<D, float> ||
+                             std::is_same_v<D, double>) {
+            return (uint32_t) member_flags::is_float | size;
+        } else if constexpr (std::is_integral_v<D> && !is_std_char_v<D> &&
+                             size <= 8) {
+            return size | (std::is_signed_v<D>
+                               ? (uint32_t) member_flags::is_signed : 0u);
+        } else {
+            return 0;
+        }
+    }
+
+    /// Annotations of def_rw()/def_ro() that do not affect field access
+    template <typename E>
+    constexpr bool is_member_extra_v =
+        std::is_convertible_v<const E &, const char *> || std::is_same_v<E, sig>;
+    template <typename E>
+    constexpr bool is_member_extra_v<for_getter<E>> = is_member_extra_v<E>;
+    template <typename E>
+    constexpr bool is_member_extra_v<for_setter<E>> = is_member_extra_v<E>;
+
+    /// Is 'C' the class 'T' or one of its non-virtual base classes?
+    template <typename T, typename C, typename = int>
+    struct is_nonvirtual_base : std::false_type { };
+    template <typename T, typename C>
+    struct is_nonvirtual_base<
+        T, C, decltype((void) static_cast<const T *>((const C *) nullptr), 0)>
+        : std::true_type { };
+
+    /// Byte offset of the field designated by the member pointer of type
+    /// 'D C::*' at 'member' within the instance 'inst' of 'T'. The backend
+    /// calls this once a live instance is at hand, since the offset cannot be
+    /// derived from a member pointer without an object to apply it to.
+    template <typename T, typename C, typename D>
+    size_t member_offset(const void *inst, const void *member) noexcept {
+        D C::*p;
+        memcpy(&p, member, sizeof(p));
+        const T *t = (const T *) inst;
+        return (size_t) ((uintptr_t) &(static_cast<const C *>(t)->*p) -
+                         (uintptr_t) t);
+    }
 }
 
 template <typename T, typename... Ts>
@@ -486,6 +548,11 @@ public:
 
         constexpr bool has_never_destruct = (std::is_same_v<Extra, never_destruct> || ...);
 
+        static_assert(std::is_same_v<Alias, T> ||
+                          !(std::is_same_v<Extra, no_identity> || ...),
+                      "nanobind::no_identity() is incompatible with trampolines, "
+                      "which must locate the Python instance of a C++ object.");
+
         if constexpr (std::is_destructible_v<T> && !has_never_destruct) {
             d.flags |= (uint32_t) detail::type_flags::is_destructible;
 
@@ -604,7 +671,7 @@ public:
             std::conditional_t<detail::is_base_caster_v<detail::make_caster<D>>,
                                const D &, D &&>;
 
-        def_prop_rw(name,
+        def_member(name, p,
             [p](const T &c) -> const D & { return c.*p; },
             [p](T &c, Q value) { c.*p = (Q) value; },
             extra...);
@@ -633,8 +700,8 @@ public:
         static_assert(std::is_base_of_v<C, T> || std::is_same_v<C, T>,
                       "def_ro() requires a (base) class member!");
 
-        def_prop_ro(name,
-            [p](const T &c) -> const D & { return c.*p; }, extra...);
+        def_member(name, p,
+            [p](const T &c) -> const D & { return c.*p; }, nullptr, extra...);
 
         return *this;
     }
@@ -665,6 +732,42 @@ public:
         NB_CALL(type_freeze)(m_ptr);
         return *this;
     }
+
+private:
+    /// Bind the field 'p' via 'getter' and 'setter'. Scalar fields get a
+    /// descriptor that accesses them directly, bypassing the function
+    /// dispatcher unless an error needs to be reported.
+    template <typename C, typename D, typename Getter, typename Setter,
+              typename... Extra>
+    NB_INLINE void def_member(const char *name_, D C::*p, Getter &&getter,
+                              Setter &&setter, const Extra &...extra) {
+        constexpr uint32_t flags =
+            detail::member_flags_for<std::remove_cv_t<D>>();
+
+        if constexpr (flags != 0 && detail::is_nonvirtual_base<T, C>::value &&
+                      sizeof(D C::*) <= 16 &&
+                      (detail::is_member_extra_v<Extra> && ...)) {
+            object get_p, set_p;
+
+            get_p = cpp_function<T>((detail::forward_t<Getter>) getter,
+                                    is_method(), is_getter(),
+                                    rv_policy::reference_internal,
+                                    detail::filter_getter(extra)...);
+
+            if constexpr (!std::is_same_v<Setter, std::nullptr_t>)
+                set_p = cpp_function<T>((detail::forward_t<Setter>) setter,
+                                        is_method(),
+                                        detail::filter_setter(extra)...);
+
+            NB_CALL(member_install)(NB_CTX, m_ptr, name_, get_p.ptr(),
+                                    set_p.ptr(), &p, sizeof(p),
+                                    detail::member_offset<T, C, D>, flags,
+                                    &typeid(std::remove_cv_t<D>));
+        } else {
+            def_prop_rw(name_, (detail::forward_t<Getter>) getter,
+                        (detail::forward_t<Setter>) setter, extra...);
+        }
+    }
 };
 
 template <typename T> class enum_ : public object {
@@ -26,6 +26,66 @@ bool from_python_remember_conv(Caster &c, PyObject **args, uint32_t flags,
     return true;
 }
 
+/// Is 'T' the type caster of an nd-array? (see ndarray.h)
+template <typename T, typename = int> struct is_ndarray_caster : std::false_type { };
+template <typename T>
+struct is_ndarray_caster<T, enable_if_t<T::IsNdarray>> : std::true_type { };
+
+/// Index sequence of the parameters 'I, I+1, ...' whose flag 'Bs' is set
+template <size_t I, typename Seq> struct index_prepend;
+template <size_t I, size_t... Is>
+struct index_prepend<I, std::index_sequence<Is...>> {
+    using type = std::index_sequence<I, Is...>;
+};
+
+template <size_t I, bool... Bs> struct index_filter {
+    using type = std::index_sequence<>;
+};
+template <size_t I, bool B, bool... Bs> struct index_filter<I, B, Bs...> {
+    using rest = typename index_filter<I + 1, Bs...>::type;
+    using type = std::conditional_t<B, typename index_prepend<I, rest>::type, rest>;
+};
+
+/// Encode the 'same_extent' annotations among 'Extra' for ndarray_import_n(),
+/// mapping parameter indices to positions among the nd-array parameters
+template <size_t Words> struct extent_links {
+    uint32_t v[Words == 0 ? 1 : Words] { };
+    size_t size = 0;
+    bool valid = true;
+};
+
+template <typename L>
+constexpr void extent_links_add(L &, const bool *, size_t, const void *) { }
+
+template <typename L, size_t Axis, size_t... Is>
+constexpr void extent_links_add(L &l, const bool *is_nd, size_t nargs,
+                                const nanobind::same_extent<Axis, Is...> *) {
+    const size_t index[] = { Is... };
+    l.v[l.size++] = (uint32_t) Axis;
+    l.v[l.size++] = (uint32_t) sizeof...(Is);
+    for (size_t i : index) {
+        // 1-based indices, as in keep_alive<>
+        if (i == 0 || i > nargs || !is_nd[i - 1]) {
+            l.valid = false;
+            return;
+        }
+        uint32_t position = 0;
+        for (size_t j = 0; j + 1 < i; ++j)
+            position += is_nd[j];
+        l.v[l.size++] = position;
+    }
+}
+
+template <size_t Words, typename... Extra, typename... Args>
+constexpr auto extent_links_static(void (*)(Args...)) {
+    constexpr bool is_nd[] = { is_ndarray_caster<make_caster<Args>>::value...,
+                               false };
+    extent_links<Words> l;
+    (extent_links_add(l, is_nd, sizeof...(Args), (Extra *) nullptr), ...);
+    (void) is_nd;
+    return l;
+}
+
 /// Compute the compile-time cast flags of every C++ function parameter.
 /// Annotations map to consecutive parameters, skipping the 'self' argument
 /// of methods (whose flags are zero).
@@ -223,6 +283,19 @@ NB_INLINE PyObject *func_create(Func &&func, Return (*)(Args...),
             "nb::kw_only() annotation must be positioned to reflect that!");
     }
 
+    // nd-array parameters, which are imported together when there are several
+    // of them or when 'same_extent' annotations relate them
+    using ndarray_args = typename index_filter<
+        0, is_ndarray_caster<make_caster<Args>>::value...>::type;
+    static constexpr bool ndarray_batch =
+        ndarray_args::size() >= 2 || Info::extent_words > 0;
+    static constexpr auto links =
+        extent_links_static<Info::extent_words, Extra...>(
+            (void (*)(Args...)) nullptr);
+    static_assert(links.valid,
+        "same_extent<> arguments must refer to nd-array parameters (using "
+        "1-based indices as in keep_alive<>)");
+
     // Collect function signature information for the docstring
     using cast_out = make_caster<
         std::conditional_t<std::is_void_v<Return>, void_type, Return>>;
@@ -311,16 +384,39 @@ NB_INLINE PyObject *func_create(Func &&func, Return (*)(Args...),
         if constexpr (Info::pre_post_hooks) {
             std::integral_constant<size_t, nargs> nargs_c;
             (process_precall(args, nargs_c, cleanup, (Extra *) nullptr), ...);
-            if ((!from_python_remember_conv(
-                     in.template get<Is>(), args,
-                     combine_flags<Is, arg_flags.v[Is]>(call_flags),
-                     cleanup, Is) || ...))
+        }
+
+        // Import several nd-arrays (or arrays with extent constraints) using
+        // a single backend call, and skip them in the per-argument loop below
+        constexpr bool batched[] = {
+            (ndarray_batch && is_ndarray_caster<make_caster<Args>>::value)...,
+            false
+        };
+
+        if constexpr (ndarray_batch) {
+            const uint32_t batch_flags[] = {
+                combine_flags<Is, arg_flags.v[Is]>(call_flags)..., 0
+            };
+            if (!ndarray_import_batch(in, args, batch_flags,
+                                      Info::pre_post_hooks, links.v,
+                                      Info::extent_words, cleanup,
+                                      ndarray_args()))
+                return NB_NEXT_OVERLOAD;
+        }
+
+        if constexpr (Info::pre_post_hooks) {
+            if ((!(batched[Is] ||
+                   from_python_remember_conv(
+                       in.template get<Is>(), args,
+                       combine_flags<Is, arg_flags.v[Is]>(call_flags),
+                       cleanup, Is)) || ...))
                 return NB_NEXT_OVERLOAD;
         } else {
-            if ((!in.template get<Is>().from_python(
-                     args[Is],
-                     combine_flags<Is, arg_flags.v[Is]>(call_flags),
-                     cleanup) || ...))
+            if ((!(batched[Is] ||
+                   in.template get<Is>().from_python(
+                       args[Is],
+                       combine_flags<Is, arg_flags.v[Is]>(call_flags),
+                       cleanup)) || ...))
                 return NB_NEXT_OVERLOAD;
         }
 
@@ -148,6 +148,21 @@ inline void set_implicit_cast_warnings(bool value) noexcept {
     NB_CALL(write_flag)(NB_CTX, detail::nb_flag::implicit_cast_warnings, value);
 }
 
+inline bool shard_stats_enabled() noexcept {
+    return NB_CALL(read_flag)(NB_CTX, detail::nb_flag::shard_stats) != 0;
+}
+
+inline void set_shard_stats_enabled(bool value) noexcept {
+    NB_CALL(write_flag)(NB_CTX, detail::nb_flag::shard_stats, value);
+}
+
+inline dict shard_stats() {
+    PyObject *result = NB_CALL(nb_shard_stats)(NB_CTX);
+    if (!result)
+        detail::raise_python_error();
+    return steal<dict>(result);
+}
+
 inline dict globals() {
 #if NB_PYTHON_VERSION >= 0x030D0000
     dict d = steal<dict>(PyEval_GetFrameGlobals());
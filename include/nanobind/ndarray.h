@@ -15,6 +15,7 @@
 
 #include <nanobind/nanobind.h>
 #include <initializer_list>
+#include <memory>
 
 NAMESPACE_BEGIN(NB_NAMESPACE)
 
@@ -291,6 +292,23 @@ struct ndarray_create_args {
     uint16_t unused;
 };
 
+/// ndarray_import_entry describes one array argument of a batched import
+/// through ndarray_import_n()
+struct ndarray_import_entry {
+    /// Location of the Python object. When the import converts the array and
+    /// the caller asks for it, it is replaced by the converted object.
+    PyObject **src;
+
+    /// Requested array configuration
+    const ndarray_config *config;
+
+    /// Cast flags of the argument ('convert', 'accepts_none')
+    uint32_t flags;
+
+    /// Imported array (output, null for an accepted 'None' argument)
+    ndarray_handle *result;
+};
+
 /// ndarray_config_t collects nd-array template parameters in a structured way.
 /// Its "storage" is purely based on types members
 template <typename /* SFINAE */ = int, typename...> struct ndarray_config_t;
@@ -336,7 +354,48 @@ template <ssize_t... Is, typename... Args> struct ndarray_config_t<int, shape<Is
 
 NAMESPACE_END(detail)
 
-template <typename Scalar, size_t Dim, char Order> struct ndarray_view {
+NAMESPACE_BEGIN(detail)
+
+/// Compile-time extents and strides of an ndarray_view (-1: not known)
+template <size_t Dim> struct ndarray_view_layout {
+    int64_t shape[Dim > 0 ? Dim : 1];
+    int64_t strides[Dim > 0 ? Dim : 1];
+};
+
+template <size_t Dim, char Order, ssize_t... Is>
+constexpr ndarray_view_layout<Dim> ndarray_view_layout_get(shape<Is...>) {
+    ndarray_view_layout<Dim> l { { (int64_t) Is... }, { } };
+
+    for (size_t i = 0; i < Dim; ++i)
+        l.strides[i] = -1;
+
+    if constexpr (Dim > 0 && (Order == 'C' || Order == 'F')) {
+        // Strides are known up to the first free extent
+        int64_t stride = 1;
+        for (size_t j = 0; j < Dim; ++j) {
+            size_t i = Order == 'C' ? Dim - 1 - j : j;
+            l.strides[i] = stride;
+            if (l.shape[i] < 0)
+                break;
+            stride *= l.shape[i];
+        }
+    }
+
+    return l;
+}
+
+NAMESPACE_END(detail)
+
+/**
+ * \brief Lightweight accessor returned by \ref ndarray::view().
+ *
+ * Extents that are fixed by a shape<..> annotation and strides that follow
+ * from them and the memory order are compile-time constants, which permits
+ * the compiler to unroll and vectorize loops over small fixed-size
+ * dimensions (e.g., the last dimension of a ``shape<-1, 3>`` point cloud).
+ */
+template <typename Scalar, size_t Dim, char Order, typename Shape = ndim<Dim>>
+struct ndarray_view {
     ndarray_view() = default;
     ndarray_view(const ndarray_view &) = default;
     ndarray_view(ndarray_view &&) = default;
@@ -349,22 +408,57 @@ template <typename Scalar, size_t Dim, char Order> struct ndarray_view {
             sizeof...(Args) == Dim,
             "ndarray_view::operator(): invalid number of arguments");
 
-        const int64_t indices_i64[] { (int64_t) indices... };
-        int64_t offset = 0;
-        for (size_t i = 0; i < Dim; ++i)
-            offset += indices_i64[i] * m_strides[i];
-
-        return *(m_data + offset);
+        return *(m_data + offset(std::make_index_sequence<Dim>(),
+                                 (int64_t) indices...));
     }
 
     size_t ndim() const { return Dim; }
-    size_t shape(size_t i) const { return (size_t) m_shape[i]; }
-    int64_t stride(size_t i) const { return m_strides[i]; }
+    size_t shape(size_t i) const {
+        return Layout.shape[i] >= 0 ? (size_t) Layout.shape[i]
+                                    : (size_t) m_shape[i];
+    }
+    int64_t stride(size_t i) const {
+        return Layout.strides[i] >= 0 ? Layout.strides[i] : m_strides[i];
+    }
     Scalar *data() const { return m_data; }
 
+    /// Total number of elements
+    size_t size() const {
+        size_t result = 1;
+        for (size_t i = 0; i < Dim; ++i)
+            result *= shape(i);
+        return result;
+    }
+
+    /// Contiguous arrays ('c_contig' or 'f_contig') can be traversed as a
+    /// flat range of 'size()' elements
+    Scalar *begin() const {
+        static_assert(Order == 'C' || Order == 'F',
+                      "ndarray_view::begin(): the array must be contiguous "
+                      "(add a c_contig or f_contig annotation)");
+        return m_data;
+    }
+
+    Scalar *end() const { return begin() + size(); }
+
 private:
     template <typename...> friend class ndarray;
 
+    static constexpr detail::ndarray_view_layout<Dim> Layout =
+        detail::ndarray_view_layout_get<Dim, Order>(Shape());
+
+    template <size_t... I, typename... Args>
+    NB_INLINE int64_t offset(std::index_sequence<I...>, Args... indices) const {
+        return (int64_t(0) + ... + (indices * stride_at<I>()));
+    }
+
+    template <size_t I> NB_INLINE int64_t stride_at() const {
+        if constexpr (Layout.strides[I] >= 0)
+            return Layout.strides[I];
+        else
+            return m_strides[I];
+    }
+
     template <size_t... I1, ssize_t... I2>
     ndarray_view(Scalar *data, const int64_t *shape, const int64_t *strides,
                  std::index_sequence<I1...>, nanobind::shape<I2...>)
@@ -576,7 +670,8 @@ public:
             "ndarray, or to the call to .view<..>()");
 
         if constexpr (has_scalar && has_shape) {
-            using Result = ndarray_view<Scalar2, N, Config2::Order::value>;
+            using Result = ndarray_view<Scalar2, N, Config2::Order::value,
+                                        typename Config2::Shape>;
             return Result((Scalar2 *) data(), shape_ptr(), stride_ptr(),
                           std::make_index_sequence<N>(),
                           typename Config2::Shape());
@@ -648,32 +743,46 @@ template <typename... Args> struct type_caster<ndarray<Args...>> {
                                     dtype_const_name<Scalar>::name) +
                    const_name("]"))
 
+    /// Lets the function dispatcher import several arrays at once
+    static constexpr bool IsNdarray = true;
+
+    /// Requested configuration, including storage for the shape
+    struct import_config {
+        ndarray_config config{Config()};
+        int64_t shape[Config::N <= 0 ? 1 : Config::N];
+
+        import_config() {
+            if constexpr (Config::N > 0) {
+                Config::Shape::put(shape);
+                config.shape = shape;
+            }
+        }
+    };
+
     bool from_python(handle src, uint32_t flags, cleanup_list *cleanup) noexcept {
         if (src.is_none() && flags & cast_flags::accepts_none) {
             value = ndarray<Args...>();
             return true;
         }
 
-        int64_t shape_buf[Config::N <= 0 ? 1 : Config::N];
-        ndarray_config config{Config()};
-
-        if constexpr (Config::N > 0) {
-            Config::Shape::put(shape_buf);
-            config.shape = shape_buf;
-        } else {
-            (void) shape_buf;
-        }
-
+        import_config c;
         detail::ndarray_handle *h = NB_CALL(ndarray_import)(NB_CTX_C(cleanup),
-            src.ptr(), &config, flags & cast_flags::convert,
+            src.ptr(), &c.config, flags & cast_flags::convert,
             cleanup);
 
+        adopt(h);
+        return h != nullptr;
+    }
+
+    /// Take ownership of an imported array
+    void adopt(detail::ndarray_handle *h) noexcept {
         if (NB_UNLIKELY(value.m_handle))
             NB_CALL(ndarray_dec_ref)(value.m_handle);
         if (NB_LIKELY(h))
             value.m_dltensor = *NB_CALL(ndarray_inc_ref)(h);
+        else
+            value.m_dltensor = dlpack::dltensor();
         value.m_handle = h;
-        return h != nullptr;
     }
 
     static handle from_cpp(const ndarray<Args...> &tensor, rv_policy policy,
@@ -692,6 +801,47 @@ public:
     static constexpr auto Name = type_caster<ndarray<Args...>>::Name;
 };
 
+template <typename Casters, size_t... Is, size_t... Ks>
+NB_INLINE bool ndarray_import_batch(Casters &in, PyObject **args,
+                                    const uint32_t *flags, bool remember,
+                                    const uint32_t *links, size_t nlinks,
+                                    cleanup_list *cleanup,
+                                    std::index_sequence<Is...>,
+                                    std::index_sequence<Ks...>) noexcept {
+    tuple<typename std::decay_t<decltype(in.template get<Is>())>::import_config...>
+        configs;
+
+    ndarray_import_entry entries[] = {
+        { args + Is, &configs.template get<Ks>().config, flags[Is], nullptr }...
+    };
+
+    if (!NB_CALL(ndarray_import_n)(NB_CTX_C(cleanup), entries, sizeof...(Is),
+                                   links, nlinks, remember, cleanup))
+        return false;
+
+    (in.template get<Is>().adopt(entries[Ks].result), ...);
+    return true;
+}
+
+/**
+ * \brief Import the array arguments 'Is...' of a function call through a
+ * single call of the ndarray_import_n() slot.
+ *
+ * The function dispatcher uses this when a function takes several arrays or
+ * has a \ref same_extent annotation. 'links' is the encoded table of extent
+ * constraints (see ndarray_import_n()).
+ */
+template <typename Casters, size_t... Is>
+NB_INLINE bool ndarray_import_batch(Casters &in, PyObject **args,
+                                    const uint32_t *flags, bool remember,
+                                    const uint32_t *links, size_t nlinks,
+                                    cleanup_list *cleanup,
+                                    std::index_sequence<Is...> is) noexcept {
+    return ndarray_import_batch(in, args, flags, remember, links, nlinks,
+                                cleanup, is,
+                                std::make_index_sequence<sizeof...(Is)>());
+}
+
 NAMESPACE_END(detail)
 
 template <typename... Args>
@@ -700,4 +850,178 @@ auto ndarray<Args...>::cast(rv_policy rvp, class handle parent) {
         nanobind::cast(*this, rvp, parent));
 }
 
+/// Move a contiguous container of scalars (e.g., ``std::vector<float>``) into
+/// a one-dimensional array that owns it, without copying its contents
+template <typename Framework = numpy, typename Container>
+auto as_ndarray(Container &&container) {
+    static_assert(!std::is_lvalue_reference_v<Container>,
+                  "nb::as_ndarray(): the container must be passed as an "
+                  "rvalue (use std::move()).");
+    using Scalar = std::remove_reference_t<decltype(*container.data())>;
+
+    // The capsule takes ownership once it has been created successfully
+    std::unique_ptr<Container> value(new Container(std::move(container)));
+    capsule owner(value.get(),
+                  [](void *p) noexcept { delete (Container *) p; });
+    Container *c = value.release();
+    size_t size = c->size();
+
+    return ndarray<Framework, Scalar, nanobind::shape<-1>>(
+        c->data(), 1, &size, owner);
+}
+
+/// Access mode of a memory-mapped array (see ndarray_mmap())
+enum class mmap_mode : uint32_t {
+    /// Map the file read-only
+    read_only = 0,
+
+    /// Writes to the array modify the file
+    read_write = 1,
+
+    /// Writes to the array create private copies of the affected pages
+    copy_on_write = 2
+};
+
+NAMESPACE_BEGIN(detail)
+
+/// Return the number of bytes occupied by an array with the given shape and
+/// dtype, or throw 'value_error(msg)' if it does not fit into a 'size_t'
+inline size_t ndarray_nbytes(std::initializer_list<size_t> shape,
+                             dlpack::dtype dtype, const char *msg) {
+    size_t size = (dtype.bits * dtype.lanes + 7) / 8;
+    bool empty = false, overflow = false;
+    for (size_t s : shape) {
+        empty |= s == 0;
+        overflow |= s != 0 && size > SIZE_MAX / s;
+        size *= s;
+    }
+    if (empty)
+        return 0;
+    if (overflow)
+        throw value_error(msg);
+    return size;
+}
+
+template <typename Array>
+Array ndarray_mmap(const char *path, int fd, std::initializer_list<size_t> shape,
+                   uint64_t offset, mmap_mode mode, dlpack::dtype dtype,
+                   char order) {
+    if (!Array::ReadOnly && mode == mmap_mode::read_only)
+        throw value_error("nanobind::ndarray_mmap(): a writable array "
+                          "requires the 'read_write' or 'copy_on_write' mode!");
+
+    size_t size = ndarray_nbytes(shape, dtype,
+                                 "nanobind::ndarray_mmap(): the array size "
+                                 "exceeds the address space!");
+
+    void *data = nullptr;
+    object owner = steal(NB_CALL(ndarray_mmap)(path, fd, offset, size,
+                                               (uint32_t) mode, &data));
+    if (!owner.is_valid())
+        raise_python_error();
+
+    return Array(data, shape.size(), shape.begin(), owner, nullptr, dtype,
+                 device::cpu::value, 0, order);
+}
+
+NAMESPACE_END(detail)
+
+/// Map the contents of the file at 'path' starting at byte 'offset' into
+/// memory and return an array referencing them
+template <typename... Args>
+ndarray<Args...> ndarray_mmap(
+    const char *path, std::initializer_list<size_t> shape,
+    uint64_t offset = 0,
+    mmap_mode mode = ndarray<Args...>::ReadOnly ? mmap_mode::read_only
+                                                 : mmap_mode::read_write,
+    dlpack::dtype dtype = nanobind::dtype<typename ndarray<Args...>::Scalar>(),
+    char order = ndarray<Args...>::Order) {
+    return detail::ndarray_mmap<ndarray<Args...>>(path, -1, shape, offset,
+                                                  mode, dtype, order);
+}
+
+/// Variant of the above that maps the open file descriptor 'fd'. The array
+/// remains valid after the descriptor is closed.
+template <typename... Args>
+ndarray<Args...> ndarray_mmap(
+    int fd, std::initializer_list<size_t> shape, uint64_t offset = 0,
+    mmap_mode mode = ndarray<Args...>::ReadOnly ? mmap_mode::read_only
+                                                 : mmap_mode::read_write,
+    dlpack::dtype dtype = nanobind::dtype<typename ndarray<Args...>::Scalar>(),
+    char order = ndarray<Args...>::Order) {
+    return detail::ndarray_mmap<ndarray<Args...>>(nullptr, fd, shape, offset,
+                                                  mode, dtype, order);
+}
+
+/// Options of ndarray_alloc()
+enum class alloc_flags : uint32_t {
+    none = 0,
+
+    /// Back allocations of at least 2 MiB with transparent huge pages when
+    /// the operating system supports them
+    huge_pages = 1
+};
+
+NAMESPACE_BEGIN(detail)
+
+template <typename Array>
+Array ndarray_alloc(std::initializer_list<size_t> shape, size_t alignment,
+                    alloc_flags flags, dlpack::dtype dtype, char order) {
+    size_t size = ndarray_nbytes(shape, dtype,
+                                 "nanobind::ndarray_alloc(): the array size "
+                                 "exceeds the address space!");
+
+    void *data = nullptr;
+    object owner = steal(NB_CALL(ndarray_alloc)(NB_CTX, size, alignment,
+                                                (uint32_t) flags, &data));
+    if (!owner.is_valid())
+        raise_python_error();
+
+    return Array(data, shape.size(), shape.begin(), owner, nullptr, dtype,
+                 device::cpu::value, 0, order);
+}
+
+NAMESPACE_END(detail)
+
+/// Allocate an uninitialized array whose storage is aligned to 'alignment'
+/// bytes (a power of two). The array owns the memory, which is released (or
+/// recycled for later allocations) once no reference to it remains.
+template <typename... Args>
+ndarray<Args...> ndarray_alloc(
+    std::initializer_list<size_t> shape, size_t alignment = 64,
+    alloc_flags flags = alloc_flags::none,
+    dlpack::dtype dtype = nanobind::dtype<typename ndarray<Args...>::Scalar>(),
+    char order = ndarray<Args...>::Order) {
+    return detail::ndarray_alloc<ndarray<Args...>>(shape, alignment, flags,
+                                                   dtype, order);
+}
+
+/// Number of threads that copy large arrays during implicit conversions
+/// (0: automatic)
+inline uint32_t ndarray_copy_threads() noexcept {
+    return NB_CALL(read_flag)(NB_CTX, detail::nb_flag::ndarray_copy_threads);
+}
+
+/// Size in bytes from which implicit conversions copy arrays in parallel
+inline uint32_t ndarray_copy_threshold() noexcept {
+    return NB_CALL(read_flag)(NB_CTX, detail::nb_flag::ndarray_copy_threshold);
+}
+
+inline void set_ndarray_copy_threads(uint32_t value) noexcept {
+    NB_CALL(write_flag)(NB_CTX, detail::nb_flag::ndarray_copy_threads, value);
+}
+
+inline void set_ndarray_copy_threshold(uint32_t value) noexcept {
+    NB_CALL(write_flag)(NB_CTX, detail::nb_flag::ndarray_copy_threshold, value);
+}
+
+/// Do repeated exports of the same array view return the same object?
+inline bool ndarray_export_cache() noexcept {
+    return NB_CALL(read_flag)(NB_CTX, detail::nb_flag::ndarray_export_cache) != 0;
+}
+
+inline void set_ndarray_export_cache(bool value) noexcept {
+    NB_CALL(write_flag)(NB_CTX, detail::nb_flag::ndarray_export_cache, value);
+}
+
 NAMESPACE_END(NB_NAMESPACE)
@@ -12,9 +12,34 @@ template <typename Array, typename Entry, size_t Size> struct array_caster {
 
     using Caster = make_caster<Entry>;
 
+    template <typename T> using has_data = decltype(std::declval<T>().data());
+    template <typename C> using has_from_python_n = decltype(&C::from_python_n);
+
+    /// Can the entries be converted in bulk via 'Caster::from_python_n'?
+    static constexpr bool batch_from_python = [] {
+        if constexpr (is_detected_v<has_from_python_n, Caster> &&
+                      is_detected_v<has_data, Array &>)
+            return std::is_same_v<typename Caster::Value, Entry> &&
+                   std::is_same_v<has_data<Array &>, Entry *>;
+        else
+            return false;
+    }();
+
+    static void *resize(void *target, size_t size) noexcept {
+        return size == Size ? ((Array *) target)->data() : nullptr;
+    }
+
     bool from_python(handle src, uint32_t flags, cleanup_list *cleanup) noexcept {
         PyObject *temp;
 
+        // Copy the contents of NumPy arrays, memoryviews, etc. directly
+        if constexpr (batch_from_python) {
+            if (NB_CALL(load_buffer)(NB_CTX_C(cleanup), src.ptr(),
+                                     Caster::buffer_kind, sizeof(Entry),
+                                     flags, resize, &value))
+                return true;
+        }
+
         // Will initialize 'temp' (NULL in the case of a failure.)
         PyObject **o = NB_CALL(seq_get_with_size)(src.ptr(), Size, &temp);
 
@@ -23,7 +48,11 @@ template <typename Array, typename Entry, size_t Size> struct array_caster {
 
         flags = flags_for_local_caster<Entry>(flags);
 
-        if (success) {
+        if constexpr (batch_from_python) {
+            if (success)
+                success = Caster::from_python_n(o, Size, flags, cleanup,
+                                                value.data()) == Size;
+        } else if (success) {
             for (size_t i = 0; i < Size; ++i) {
                 if (!caster.from_python(o[i], flags, cleanup) ||
                     !caster.template can_cast<Entry>()) {
@@ -43,6 +72,11 @@ template <typename Array, typename Entry, size_t Size> struct array_caster {
     template <typename T>
     static handle from_cpp(T &&src, rv_policy policy,
                            cleanup_list *cleanup) noexcept {
+        if constexpr (batch_from_python && sizeof(Entry) <= sizeof(double))
+            return NB_CALL(seq_from_buffer)(src.data(), Size,
+                                            Caster::buffer_kind, sizeof(Entry),
+                                            false);
+
         seq_builder<false> b(Size);
 
         if (NB_UNLIKELY(!b.valid()))
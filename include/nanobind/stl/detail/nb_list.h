@@ -22,33 +22,76 @@ template <typename List, typename Entry> struct list_caster {
     using Caster = make_caster<Entry>;
 
     template <typename T> using has_reserve = decltype(std::declval<T>().reserve(0));
+    template <typename T> using has_data = decltype(std::declval<T>().data());
+    template <typename T> using has_resize = decltype(std::declval<T>().resize(0));
+    template <typename C> using has_from_python_n = decltype(&C::from_python_n);
+
+    /// Can the entries be converted in bulk via 'Caster::from_python_n'? This
+    /// requires contiguous storage of the caster's value type.
+    static constexpr bool batch_from_python = [] {
+        if constexpr (is_detected_v<has_from_python_n, Caster> &&
+                      is_detected_v<has_data, List &> &&
+                      is_detected_v<has_resize, List>)
+            return std::is_same_v<typename Caster::Value, Entry> &&
+                   std::is_same_v<has_data<List &>, Entry *>;
+        else
+            return false;
+    }();
+
+    static void *resize(void *target, size_t size) noexcept {
+        List &list = *(List *) target;
+        try {
+            list.resize(size);
+        } catch (...) {
+            return nullptr;
+        }
+        // data() may be null when empty; any other pointer signals success
+        return size ? (void *) list.data() : target;
+    }
 
     bool from_python(handle src, uint32_t flags, cleanup_list *cleanup) noexcept {
         size_t size;
         PyObject *temp;
 
+        // Copy the contents of NumPy arrays, memoryviews, etc. directly
+        if constexpr (batch_from_python) {
+            if (NB_CALL(load_buffer)(NB_CTX_C(cleanup), src.ptr(),
+                                     Caster::buffer_kind, sizeof(Entry),
+                                     flags, resize, &value))
+                return true;
+        }
+
         // Will initialize 'size' and 'temp'. All return values and
         // return parameters are zero/NULL in the case of a failure.
         PyObject **o = NB_CALL(seq_get)(src.ptr(), &size, &temp);
 
         value.clear();
 
-        if constexpr (is_detected_v<has_reserve, List>)
-            value.reserve(size);
-
-        Caster caster;
         bool success = o != nullptr;
 
         flags = flags_for_local_caster<Entry>(flags);
 
-        for (size_t i = 0; i < size; ++i) {
-            if (!caster.from_python(o[i], flags, cleanup) ||
-                !caster.template can_cast<Entry>()) {
-                success = false;
-                break;
+        if constexpr (batch_from_python) {
+            if (success) {
+                value.resize(size);
+                success = Caster::from_python_n(o, size, flags, cleanup,
+                                                value.data()) == size;
             }
+        } else {
+            if constexpr (is_detected_v<has_reserve, List>)
+                value.reserve(size);
+
+            Caster caster;
 
-            value.push_back(caster.operator cast_t<Entry>());
+            for (size_t i = 0; i < size; ++i) {
+                if (!caster.from_python(o[i], flags, cleanup) ||
+                    !caster.template can_cast<Entry>()) {
+                    success = false;
+                    break;
+                }
+
+                value.push_back(caster.operator cast_t<Entry>());
+            }
         }
 
         Py_XDECREF(temp);
@@ -56,9 +99,44 @@ template <typename List, typename Entry> struct list_caster {
         return success;
     }
 
+    /// Can instances be created in bulk via 'nb_type_put_n'? This requires
+    /// contiguous storage of a bound type whose dynamic type is known.
+    static constexpr bool batch_from_cpp = [] {
+        if constexpr (is_base_caster_v<Caster> &&
+                      is_detected_v<has_data, List &>)
+            return std::is_same_v<typename Caster::Type, Entry> &&
+                   std::is_same_v<has_data<List &>, Entry *> &&
+                   !std::is_polymorphic_v<Entry> &&
+                   std::is_base_of_v<std::false_type, type_hook<Entry>>;
+        else
+            return false;
+    }();
+
     template <typename T>
     static handle from_cpp(T &&src, rv_policy policy,
                            cleanup_list *cleanup) noexcept {
+        if constexpr (batch_from_python && sizeof(Entry) <= sizeof(double)) {
+            return NB_CALL(seq_from_buffer)(src.data(), src.size(),
+                                            Caster::buffer_kind, sizeof(Entry),
+                                            false);
+        } else if constexpr (batch_from_cpp) {
+            rv_policy p = infer_policy<forwarded_type<T, Entry &>>(policy);
+
+            if (p == rv_policy::copy || p == rv_policy::move) {
+                size_t size = src.size();
+                PyObject **items;
+                void *builder = NB_CALL(list_alloc)(size, &items);
+                if (NB_UNLIKELY(!builder))
+                    return {};
+
+                bool success = NB_CALL(nb_type_put_n)(
+                    NB_CTX_C(cleanup), &typeid(Entry), (void *) src.data(),
+                    sizeof(Entry), size, p, cleanup, items);
+
+                return NB_CALL(seq_commit)(builder, success ? size : SIZE_MAX);
+            }
+        }
+
         seq_builder<false> b(src.size());
 
         if (NB_UNLIKELY(!b.valid()))
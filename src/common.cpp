@@ -445,6 +445,64 @@ PyObject *seq_commit(void *builder, size_t n_valid) noexcept {
 #endif
 }
 
+/// Fill 'items' with Python versions of the scalars 'data[0..n)'. Returns the
+/// number of entries that could be created.
+template <typename T>
+static size_t seq_fill(const void *data, size_t n, PyObject **items) noexcept {
+    const T *values = (const T *) data;
+
+    for (size_t i = 0; i < n; ++i) {
+        T value = values[i];
+        PyObject *o;
+
+        if constexpr (std::is_floating_point_v<T>)
+            o = PyFloat_FromDouble((double) value);
+        else if constexpr (std::is_signed_v<T>)
+            o = sizeof(T) <= sizeof(long) ? PyLong_FromLong((long) value)
+                                          : PyLong_FromLongLong((long long) value);
+        else
+            o = sizeof(T) <= sizeof(unsigned long)
+                    ? PyLong_FromUnsignedLong((unsigned long) value)
+                    : PyLong_FromUnsignedLongLong((unsigned long long) value);
+
+        if (NB_UNLIKELY(!o))
+            return i;
+
+        items[i] = o;
+    }
+
+    return n;
+}
+
+PyObject *seq_from_buffer(const void *data, size_t n, char kind, size_t size,
+                          bool tuple) noexcept {
+    PyObject **items;
+    void *builder = tuple ? tuple_alloc(n, &items) : list_alloc(n, &items);
+    if (NB_UNLIKELY(!builder))
+        return nullptr;
+
+    bool is_signed = kind == 'i';
+    size_t n_valid;
+
+    if (kind == 'f')
+        n_valid = size == sizeof(double) ? seq_fill<double>(data, n, items)
+                                         : seq_fill<float>(data, n, items);
+    else if (size == 1)
+        n_valid = is_signed ? seq_fill<int8_t>(data, n, items)
+                            : seq_fill<uint8_t>(data, n, items);
+    else if (size == 2)
+        n_valid = is_signed ? seq_fill<int16_t>(data, n, items)
+                            : seq_fill<uint16_t>(data, n, items);
+    else if (size == 4)
+        n_valid = is_signed ? seq_fill<int32_t>(data, n, items)
+                            : seq_fill<uint32_t>(data, n, items);
+    else
+        n_valid = is_signed ? seq_fill<int64_t>(data, n, items)
+                            : seq_fill<uint64_t>(data, n, items);
+
+    return seq_commit(builder, n_valid);
+}
+
 #if defined(Py_LIMITED_API) || defined(PYPY_VERSION)
 /// Capsule destructor of a null-terminated array of strong references
 static void array_capsule_free(PyObject *o) noexcept {
@@ -1096,6 +1154,103 @@ bool load_i64(nb_internals *p, PyObject *o, uint32_t flags,
     return load_int(p, o, flags, out);
 }
 
+// The bulk conversions below inline the exact-type fast paths of the
+// conversions above into a single loop over the input
+
+template <typename T>
+NB_INLINE size_t load_int_n(nb_internals *p, PyObject **items, size_t n,
+                            uint32_t flags, T *out) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        if (NB_UNLIKELY(!load_int(p, items[i], flags, out + i)))
+            return i;
+    }
+    return n;
+}
+
+size_t load_i8_n(nb_internals *p, PyObject **items, size_t n,
+                 uint32_t flags, int8_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_u8_n(nb_internals *p, PyObject **items, size_t n,
+                 uint32_t flags, uint8_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_i16_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, int16_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_u16_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, uint16_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_i32_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, int32_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_u32_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, uint32_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_i64_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, int64_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_u64_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, uint64_t *out) noexcept {
+    return load_int_n(p, items, n, flags, out);
+}
+
+size_t load_f64_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, double *out) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        PyObject *o = items[i];
+
+#if !defined(Py_LIMITED_API)
+        if (NB_LIKELY(PyFloat_CheckExact(o))) {
+            out[i] = PyFloat_AS_DOUBLE(o);
+            continue;
+        }
+#endif
+
+        if (NB_UNLIKELY(!load_f64(p, o, flags, out + i)))
+            return i;
+    }
+    return n;
+}
+
+size_t load_f32_n(nb_internals *p, PyObject **items, size_t n,
+                  uint32_t flags, float *out) noexcept {
+#if !defined(Py_LIMITED_API)
+    bool convert = flags & cast_flags::convert;
+#endif
+
+    for (size_t i = 0; i < n; ++i) {
+        PyObject *o = items[i];
+
+#if !defined(Py_LIMITED_API)
+        if (NB_LIKELY(PyFloat_CheckExact(o))) {
+            double d = PyFloat_AS_DOUBLE(o);
+            float result = (float) d;
+            if (NB_UNLIKELY(!convert && (double) result != d && d == d))
+                return i;
+            out[i] = result;
+            continue;
+        }
+#endif
+
+        if (NB_UNLIKELY(!load_f32(p, o, flags, out + i)))
+            return i;
+    }
+    return n;
+}
+
 // ========================================================================
 
 bool gil_check() noexcept {
@@ -1139,6 +1294,14 @@ uint32_t read_flag(nb_internals *p, nb_flag f) noexcept {
             return p->print_leak_warnings;
         case nb_flag::implicit_cast_warnings:
             return p->print_implicit_cast_warnings;
+        case nb_flag::ndarray_copy_threads:
+            return p->ndarray_copy_threads;
+        case nb_flag::ndarray_copy_threshold:
+            return p->ndarray_copy_threshold;
+        case nb_flag::ndarray_export_cache:
+            return p->ndarray_export_cache;
+        case nb_flag::shard_stats:
+            return p->shard_stats;
         default:
             fail("nanobind::detail::read_flag(): unknown flag!");
     }
@@ -1152,6 +1315,33 @@ void write_flag(nb_internals *p, nb_flag f, uint32_t value) {
         case nb_flag::implicit_cast_warnings:
             p->print_implicit_cast_warnings = value != 0;
             break;
+        case nb_flag::ndarray_copy_threads:
+            p->ndarray_copy_threads = value;
+            break;
+        case nb_flag::ndarray_copy_threshold:
+            p->ndarray_copy_threshold = value;
+            break;
+        case nb_flag::ndarray_export_cache:
+            p->ndarray_export_cache = value != 0;
+            // Release the weak references held by the cache. Free-threaded
+            // builds can only reach the calling thread's cache here, the
+            // others are released when their threads exit.
+            if (!value) {
+#if defined(NB_FREE_THREADED)
+                nb_ndarray_exports_clear(
+                    nb_thread_state_get(p)->ndarray_exports);
+#else
+                nb_ndarray_exports_clear(p->ndarray_exports);
+#endif
+            }
+            break;
+        case nb_flag::shard_stats:
+            p->shard_stats = value != 0;
+#if defined(NB_FREE_THREADED)
+            for (size_t i = 0; i < p->shard_count; ++i)
+                p->shards[i].stats.store(value != 0, std::memory_order_relaxed);
+#endif
+            break;
         default:
             raise("nanobind::detail::write_flag(): unknown flag!");
     }
@@ -129,6 +129,7 @@ static PyObject *enum_create_impl(nb_internals *p, const enum_data_init *ed) {
     {
         lock_internals guard(p);
         p->type_c2p_slow[ed->type] = t;
+        nb_type_epoch_bump(p);
 
         #if !defined(NB_FREE_THREADED)
             p->type_c2p_fast[(void *) ed->type] = t;
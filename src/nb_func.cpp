@@ -42,6 +42,8 @@ static PyObject *nb_func_vectorcall_complex(PyObject *, PyObject *const *,
 static uint32_t nb_func_render_signature(Buffer &buf, nb_internals *internals_,
                                          const func_data *f,
                                          bool nb_signature_mode = false) noexcept;
+static void nb_ov_cache_free(nb_func *func) noexcept;
+static void nb_kw_plans_free(nb_func *func) noexcept;
 
 int nb_func_traverse(PyObject *self, visitproc visit, void *arg) {
     size_t size = (size_t) Py_SIZE(self);
@@ -124,6 +126,8 @@ void nb_func_dealloc(PyObject *self) {
     }
 
     Py_XDECREF(((nb_func *) self)->module_name);
+    nb_ov_cache_free((nb_func *) self);
+    nb_kw_plans_free((nb_func *) self);
 
     nb_internals *p = nb_func_internals(self);
     PyTypeObject *tp = Py_TYPE(self);
@@ -330,6 +334,7 @@ PyObject *nb_func_new(nb_internals *p, const func_data_init_base *f) noexcept {
     }
 
     uint32_t max_nargs = f->nargs;
+    bool cache_overloads = f->flags & (uint32_t) func_flags::cache_overloads;
 
     const char *prev_doc = nullptr;
 
@@ -337,6 +342,7 @@ PyObject *nb_func_new(nb_internals *p, const func_data_init_base *f) noexcept {
         nb_func *nb_func_prev = (nb_func *) func_prev;
         complexity = std::max(complexity, nb_func_prev->complexity);
         max_nargs = std::max(max_nargs, nb_func_prev->max_nargs);
+        cache_overloads |= nb_func_prev->cache_overloads;
 
         func_data *cur  = nb_func_data(func),
                   *prev = nb_func_data(func_prev);
@@ -360,6 +366,7 @@ PyObject *nb_func_new(nb_internals *p, const func_data_init_base *f) noexcept {
 
     func->max_nargs = max_nargs;
     func->complexity = complexity;
+    func->cache_overloads = cache_overloads;
     func->internals = p;
     func->scope = has_scope ? f->scope : nullptr;
 
@@ -660,6 +667,333 @@ NB_INLINE uint32_t func_dispatch_flags(const func_data *f, bool convert,
                 ? (uint32_t) cast_flags::trusted : 0u);
 }
 
+/* Overload resolution cache (nb::cache_overloads)
+
+   Calls that resolve to a late overload of a long chain first pay for the
+   rejection of every overload in front of it. Functions that opt into the
+   cache remember, for a few recently seen argument type signatures, the
+   overload and pass that accepted the call. The dispatchers try this
+   candidate first and fall back to the regular traversal when it declines.
+
+   The key consists of the types of all arguments and the identity of the
+   keyword name tuple, which the entry references. Only candidates whose
+   predecessors were all rejected before calling their implementation are
+   recorded (see the dispatchers). Those rejections follow from the number,
+   names, and 'None'-ness of the arguments alone, so a key whose type object
+   address was recycled still yields the right candidate. Chain
+   modifications create a new 'nb_func', which starts with an empty cache.
+
+   A sequence counter protects each entry. Lookups in free-threaded builds
+   thus never block: they validate the counter after reading the key and
+   treat a concurrent update as a miss. Writers that lose the race to claim
+   an entry drop their update. */
+
+/// Number of entries of the overload resolution cache (a power of two)
+#define NB_OV_CACHE_SIZE 4
+
+/// Marks the absence of a cached candidate
+#define NB_OV_NONE ((size_t) -1)
+
+struct nb_ov_cache_entry {
+    /// Sequence counter, odd while a writer updates the entry
+    nb_maybe_atomic<uint32_t> seq;
+
+    /// Number of argument types (bits 0-7), validity (bit 8), chain
+    /// position 'pass * count + overload index' (bits 9-31)
+    nb_maybe_atomic<uint32_t> info;
+
+    /// Keyword argument names of the call (compared by identity)
+    nb_maybe_atomic<PyObject *> kwnames;
+
+    /// Types of the positional and keyword arguments
+    nb_maybe_atomic<PyTypeObject *> types[NB_MAXARGS_SIMPLE];
+};
+
+struct nb_ov_cache {
+    nb_ov_cache_entry entries[NB_OV_CACHE_SIZE];
+};
+
+/// Argument type signature of a call, used to query the cache
+struct nb_ov_key {
+    PyTypeObject *types[NB_MAXARGS_SIMPLE];
+    PyObject *kwnames;
+    uint32_t nargs;
+    uint32_t index;
+};
+
+/// Compute the cache key of a call. Fails for calls with too many arguments.
+NB_INLINE bool nb_ov_key_init(nb_ov_key &key, PyObject *const *args,
+                              size_t nargs, PyObject *kwnames) noexcept {
+    if (nargs > NB_MAXARGS_SIMPLE)
+        return false;
+
+    uintptr_t h = (uintptr_t) kwnames;
+    for (size_t i = 0; i < nargs; ++i) {
+        PyTypeObject *tp = Py_TYPE(args[i]);
+        key.types[i] = tp;
+        h = (h * 31) ^ (uintptr_t) tp;
+    }
+
+    key.kwnames = kwnames;
+    key.nargs = (uint32_t) nargs;
+    key.index = (uint32_t) fmix64((uint64_t) h) & (NB_OV_CACHE_SIZE - 1);
+    return true;
+}
+
+/// Return the chain position of the overload that accepted the last call with
+/// a matching argument type signature, or NB_OV_NONE
+static size_t nb_ov_cache_lookup(nb_func *func, const nb_ov_key &key) noexcept {
+    nb_ov_cache *cache = func->ov_cache.load_acquire();
+    if (!cache)
+        return NB_OV_NONE;
+
+    nb_ov_cache_entry &e = cache->entries[key.index];
+    uint32_t seq  = e.seq.load_acquire(),
+             info = e.info.load_relaxed();
+
+    bool match = (seq & 1) == 0 && (info & 0x100) &&
+                 (info & 0xFF) == key.nargs &&
+                 e.kwnames.load_relaxed() == key.kwnames;
+
+    for (uint32_t i = 0; match && i < key.nargs; ++i)
+        match = e.types[i].load_relaxed() == key.types[i];
+
+#if defined(NB_FREE_THREADED)
+    std::atomic_thread_fence(std::memory_order_acquire);
+    match &= e.seq.load_relaxed() == seq;
+#endif
+
+    return match ? (size_t) (info >> 9) : NB_OV_NONE;
+}
+
+/// Record that the overload at chain position 'pos' accepted a call
+static NB_NOINLINE void nb_ov_cache_store(nb_func *func, const nb_ov_key &key,
+                                          size_t pos) noexcept {
+    nb_ov_cache *cache = func->ov_cache.load_acquire();
+    if (!cache) {
+        cache = (nb_ov_cache *) PyMem_Calloc(1, sizeof(nb_ov_cache));
+        if (!cache) // it's just a cache..
+            return;
+#if defined(NB_FREE_THREADED)
+        nb_ov_cache *expected = nullptr;
+        if (!func->ov_cache.value.compare_exchange_strong(
+                expected, cache, std::memory_order_acq_rel)) {
+            PyMem_Free(cache);
+            cache = expected;
+        }
+#else
+        func->ov_cache.store_release(cache);
+#endif
+    }
+
+    nb_ov_cache_entry &e = cache->entries[key.index];
+    uint32_t seq = e.seq.load_relaxed();
+
+#if defined(NB_FREE_THREADED)
+    // Claim the entry, or leave it to a concurrent writer
+    if ((seq & 1) || !e.seq.value.compare_exchange_strong(
+                         seq, seq + 1, std::memory_order_relaxed))
+        return;
+    std::atomic_thread_fence(std::memory_order_release);
+#endif
+
+    // Keep the name tuple alive, so that its address cannot match another
+    // tuple while the entry exists
+    PyObject *kwnames_prev = e.kwnames.load_relaxed();
+    e.kwnames.store_relaxed(Py_XNewRef(key.kwnames));
+    for (uint32_t i = 0; i < key.nargs; ++i)
+        e.types[i].store_relaxed(key.types[i]);
+    e.info.store_relaxed(key.nargs | 0x100 | (uint32_t) (pos << 9));
+    e.seq.store_release(seq + 2);
+    Py_XDECREF(kwnames_prev);
+}
+
+static void nb_ov_cache_free(nb_func *func) noexcept {
+    nb_ov_cache *cache = func->ov_cache.load_relaxed();
+    if (!cache)
+        return;
+    for (nb_ov_cache_entry &e : cache->entries)
+        Py_XDECREF(e.kwnames.load_relaxed());
+    PyMem_Free(cache);
+}
+
+/// Number of steps needed to traverse an overload chain of length 'count':
+/// two passes (one, if there are no overloads), preceded by the cached
+/// candidate 'hint' if there is one
+NB_INLINE size_t nb_ov_steps(size_t count, size_t hint) {
+    return (count > 1 ? 2 * count : 1) + (hint != NB_OV_NONE);
+}
+
+/// Map a traversal step onto a chain position 'pass * count + overload index'.
+/// Functions without overloads skip the strict first pass.
+NB_INLINE size_t nb_ov_pos(size_t step, size_t count, size_t hint) {
+    size_t begin = count > 1 ? 0 : 1;
+    if (hint == NB_OV_NONE)
+        return begin + step;
+    return step == 0 ? hint : begin + step - 1;
+}
+
+/* Keyword argument plans
+
+   Matching keyword arguments against the parameter names of each overload
+   requires O(nargs * nkwargs) comparisons. Call sites usually pass the same
+   keyword name tuple in every call, since CPython stores it among the
+   constants of the calling code object. The complex dispatcher therefore
+   records the outcome of this matching in a plan, which maps every parameter
+   of every overload onto the index of the keyword argument providing it.
+
+   A function stores up to NB_KW_PLANS plans. They hold a reference to their
+   name tuple and match calls by its identity or, failing that, by comparing
+   the interned names. Plans are immutable and never replaced once published.
+   This keeps them valid while the dispatcher runs arbitrary Python code, and
+   free-threaded builds need no further synchronization. Calls using other
+   combinations of keyword names take the regular path.
+
+   Only name tuples that recur across calls receive a plan. Tuples built
+   afresh for every call (e.g., by 'f(**kwargs)') would otherwise claim the
+   few plan slots for good. The first miss therefore merely records the tuple
+   as pending, and a plan is created when the next miss passes the same
+   tuple. The pending tuple is referenced, so that its address cannot be
+   recycled by another tuple in the meantime. */
+
+/// Marks a parameter that no keyword argument provides
+#define NB_KW_NONE 0xFF
+
+struct nb_kw_plan {
+    /// Keyword argument names (strong reference)
+    PyObject *kwnames;
+
+    /// Per overload: does every keyword argument match a parameter?
+    bool *consumed;
+
+    /// Per overload and parameter ('count * max_nargs' entries): index of the
+    /// keyword argument providing the parameter, or NB_KW_NONE
+    uint8_t *slot;
+};
+
+/// Find the plan matching the keyword argument names of a call
+NB_INLINE const nb_kw_plan *nb_kw_plan_lookup(nb_func *func,
+                                              PyObject *kwargs_in,
+                                              PyObject *const *kwnames,
+                                              size_t nkwargs) noexcept {
+    for (size_t i = 0; i < NB_KW_PLANS; ++i) {
+        const nb_kw_plan *plan = func->kw_plans[i].load_acquire();
+        if (!plan)
+            break;
+        if (plan->kwnames == kwargs_in)
+            return plan;
+        if ((size_t) NB_TUPLE_GET_SIZE(plan->kwnames) != nkwargs)
+            continue;
+
+        size_t j = 0;
+        while (j < nkwargs &&
+               NB_TUPLE_GET_ITEM(plan->kwnames, (Py_ssize_t) j) == kwnames[j])
+            ++j;
+        if (j == nkwargs)
+            return plan;
+    }
+
+    return nullptr;
+}
+
+/// Match the keyword argument names of a call against all overloads and
+/// publish the result as a new plan. Returns nullptr if no slot is available
+/// or the name tuple is seen for the first time.
+static NB_NOINLINE const nb_kw_plan *
+nb_kw_plan_new(nb_func *func, PyObject *kwargs_in, PyObject *const *kwnames,
+               size_t nkwargs) noexcept {
+    if (nkwargs >= NB_KW_NONE)
+        return nullptr;
+
+    size_t index = 0;
+    while (index < NB_KW_PLANS && func->kw_plans[index].load_acquire())
+        ++index;
+    if (index == NB_KW_PLANS)
+        return nullptr;
+
+    if (func->kw_pending.load_acquire() != kwargs_in) {
+#if defined(NB_FREE_THREADED)
+        PyObject *prev = func->kw_pending.value.exchange(
+            Py_NewRef(kwargs_in), std::memory_order_acq_rel);
+#else
+        PyObject *prev = func->kw_pending.value;
+        func->kw_pending.value = Py_NewRef(kwargs_in);
+#endif
+        Py_XDECREF(prev);
+        return nullptr;
+    }
+
+    const size_t count = (size_t) Py_SIZE(func),
+                 max_nargs = func->max_nargs;
+
+    nb_kw_plan *plan = (nb_kw_plan *) PyMem_Malloc(
+        sizeof(nb_kw_plan) + count * (1 + max_nargs));
+    if (!plan) // it's just a cache..
+        return nullptr;
+
+    plan->kwnames = Py_NewRef(kwargs_in);
+    plan->consumed = (bool *) (plan + 1);
+    plan->slot = (uint8_t *) (plan->consumed + count);
+    memset(plan->slot, NB_KW_NONE, count * max_nargs);
+
+    const func_data *f = nb_func_data((PyObject *) func);
+    for (size_t k = 0; k < count; ++k, ++f) {
+        uint8_t *slot = plan->slot + k * max_nargs;
+        size_t matched = 0;
+
+        if (f->flags & (uint32_t) func_flags::has_args) {
+            const bool has_var_args =
+                           f->flags & (uint32_t) func_flags::has_var_args,
+                       has_var_kwargs =
+                           f->flags & (uint32_t) func_flags::has_var_kwargs;
+
+            // Mirror the parameter traversal of nb_func_vectorcall_complex
+            size_t nargs_step1 = f->nargs - has_var_kwargs;
+            for (size_t i = 0; i < nargs_step1; ++i) {
+                PyObject *name = f->args[i].name_py;
+                if (!name || (has_var_args && i == f->nargs_pos))
+                    continue;
+
+                for (size_t j = 0; j < nkwargs; ++j) {
+                    if (kwnames[j] == name) {
+                        slot[i] = (uint8_t) j;
+                        matched++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        plan->consumed[k] = matched == nkwargs;
+    }
+
+#if defined(NB_FREE_THREADED)
+    nb_kw_plan *expected = nullptr;
+    if (!func->kw_plans[index].value.compare_exchange_strong(
+            expected, plan, std::memory_order_acq_rel)) {
+        Py_DECREF(plan->kwnames);
+        PyMem_Free(plan);
+        return nullptr;
+    }
+#else
+    func->kw_plans[index].store_release(plan);
+#endif
+
+    return plan;
+}
+
+/// Release the keyword argument plans and the pending name tuple of a function
+static void nb_kw_plans_free(nb_func *func) noexcept {
+    for (size_t i = 0; i < NB_KW_PLANS; ++i) {
+        nb_kw_plan *plan = func->kw_plans[i].load_relaxed();
+        if (plan) {
+            Py_DECREF(plan->kwnames);
+            PyMem_Free(plan);
+        }
+    }
+    Py_XDECREF(func->kw_pending.load_relaxed());
+}
+
 /// Dispatch loop that is used to invoke functions created by nb_func_new
 static PyObject *nb_func_vectorcall_complex(PyObject *self,
                                             PyObject *const *args_in,
@@ -761,166 +1095,221 @@ static PyObject *nb_func_vectorcall_complex(PyObject *self,
     // If one of these fail, move on to the next overload and keep trying
     // until we get a result other than NB_NEXT_OVERLOAD.
 
-    for (size_t pass = (count > 1) ? 0 : 1; pass < 2; ++pass) {
-        for (size_t k = 0; k < count; ++k) {
-            const func_data *f = fr + k;
-
-            const bool has_args       = f->flags & (uint32_t) func_flags::has_args,
-                       has_var_args   = f->flags & (uint32_t) func_flags::has_var_args,
-                       has_var_kwargs = f->flags & (uint32_t) func_flags::has_var_kwargs;
-
-            // Number of C++ parameters eligible to be filled from individual
-            // Python positional arguments
-            size_t nargs_pos = f->nargs_pos;
+    // Fetch the precomputed keyword argument matching
+    const nb_kw_plan *kw_plan = nullptr;
+    if (kwargs_in) {
+        kw_plan = nb_kw_plan_lookup((nb_func *) self, kwargs_in, kwnames,
+                                    nkwargs_in);
+        if (!kw_plan)
+            kw_plan = nb_kw_plan_new((nb_func *) self, kwargs_in, kwnames,
+                                     nkwargs_in);
+    }
 
-            // Number of C++ parameters in total, except for a possible trailing
-            // nb::kwargs. All of these are eligible to be filled from individual
-            // Python arguments (keyword always, positional until index nargs_pos)
-            // except for a potential nb::args, which exists at index nargs_pos
-            // if has_var_args is true. We'll skip that one in the individual-args
-            // loop, and go back and fill it later with the unused positionals.
-            size_t nargs_step1 = f->nargs - has_var_kwargs;
+    // Try the candidate memoized by the overload resolution cache first
+    nb_ov_key ov_key;
+    const bool use_cache =
+        ((nb_func *) self)->cache_overloads &&
+        nb_ov_key_init(ov_key, args_in, nargs_in + nkwargs_in, kwargs_in);
+    const size_t hint =
+        use_cache ? nb_ov_cache_lookup((nb_func *) self, ov_key) : NB_OV_NONE;
+
+    // Number of candidates whose implementation was called
+    size_t invoked = 0;
+
+    for (size_t step = 0, steps = nb_ov_steps(count, hint); step < steps;
+         ++step) {
+        const size_t pos  = nb_ov_pos(step, count, hint),
+                     pass = pos >= count,
+                     k    = pos - pass * count;
+
+        if (NB_UNLIKELY(pos == hint) && step != 0)
+            continue; // the cached candidate declined already
+
+        const func_data *f = fr + k;
+
+        const bool has_args       = f->flags & (uint32_t) func_flags::has_args,
+                   has_var_args   = f->flags & (uint32_t) func_flags::has_var_args,
+                   has_var_kwargs = f->flags & (uint32_t) func_flags::has_var_kwargs;
+
+        // Number of C++ parameters eligible to be filled from individual
+        // Python positional arguments
+        size_t nargs_pos = f->nargs_pos;
+
+        // Number of C++ parameters in total, except for a possible trailing
+        // nb::kwargs. All of these are eligible to be filled from individual
+        // Python arguments (keyword always, positional until index nargs_pos)
+        // except for a potential nb::args, which exists at index nargs_pos
+        // if has_var_args is true. We'll skip that one in the individual-args
+        // loop, and go back and fill it later with the unused positionals.
+        size_t nargs_step1 = f->nargs - has_var_kwargs;
+
+        if (nargs_in > nargs_pos && !has_var_args)
+            continue; // Too many positional arguments given for this overload
+
+        if (nargs_in < nargs_pos && !has_args)
+            continue; // Not enough positional arguments, insufficient
+                      // keyword/default arguments to fill in the blanks
+
+        const uint8_t *kw_slot = nullptr;
+        if (kw_plan) {
+            if (!kw_plan->consumed[k] && !has_var_kwargs)
+                continue; // Unknown keyword arguments for this overload
+            kw_slot = kw_plan->slot + k * max_nargs;
+        } else {
+            memset(kwarg_used, 0, nkwargs_in * sizeof(bool));
+        }
 
-            if (nargs_in > nargs_pos && !has_var_args)
-                continue; // Too many positional arguments given for this overload
+        // 1. Copy individual arguments, potentially substitute kwargs/defaults
+        size_t i = 0;
+        for (; i < nargs_step1; ++i) {
+            if (has_var_args && i == nargs_pos)
+                continue; // skip nb::args parameter, will be handled below
+
+            PyObject *arg = nullptr;
+
+            uint32_t arg_flag = 0;
+
+            // If i >= nargs_pos, then this is a keyword-only parameter.
+            // (We skipped any *args parameter using the test above,
+            // and we set the bounds of nargs_step1 to not include any
+            // **kwargs parameter.) In that case we don't want to take
+            // a positional arg (which might validly exist and be
+            // destined for the *args) but we do still want to look for
+            // a matching keyword arg.
+            if (i < nargs_in && i < nargs_pos)
+                arg = args_in[i];
+
+            if (has_args) {
+                const arg_data &ad = f->args[i];
+
+                PyObject *hit = nullptr;
+                if (kw_slot) {
+                    if (kw_slot[i] != NB_KW_NONE)
+                        hit = args_in[nargs_in + kw_slot[i]];
+                } else if (kwargs_in && ad.name_py) {
+                    for (size_t j = 0; j < nkwargs_in; ++j) {
+                        if (kwnames[j] == ad.name_py) {
+                            hit = args_in[nargs_in + j];
+                            kwarg_used[j] = true;
+                            break;
+                        }
+                    }
+                }
 
-            if (nargs_in < nargs_pos && !has_args)
-                continue; // Not enough positional arguments, insufficient
-                          // keyword/default arguments to fill in the blanks
+                if (hit) {
+                    if (arg)
+                        break; // conflict between keyword and positional arg.
+                    arg = hit;
+                }
 
-            memset(kwarg_used, 0, nkwargs_in * sizeof(bool));
+                if (!arg)
+                    arg = ad.value;
+                arg_flag = ad.flag;
+            }
 
-            // 1. Copy individual arguments, potentially substitute kwargs/defaults
-            size_t i = 0;
-            for (; i < nargs_step1; ++i) {
-                if (has_var_args && i == nargs_pos)
-                    continue; // skip nb::args parameter, will be handled below
+            if (!arg || (arg == none_ptr() && (arg_flag & cast_flags::accepts_none) == 0))
+                break;
 
-                PyObject *arg = nullptr;
+            args[i] = arg;
+        }
 
-                uint32_t arg_flag = 0;
+        // Skip this overload if any arguments were unavailable
+        if (i != nargs_step1)
+            continue;
 
-                // If i >= nargs_pos, then this is a keyword-only parameter.
-                // (We skipped any *args parameter using the test above,
-                // and we set the bounds of nargs_step1 to not include any
-                // **kwargs parameter.) In that case we don't want to take
-                // a positional arg (which might validly exist and be
-                // destined for the *args) but we do still want to look for
-                // a matching keyword arg.
-                if (i < nargs_in && i < nargs_pos)
-                    arg = args_in[i];
+        // Deal with remaining positional arguments
+        if (has_var_args) {
+            PyObject *tuple = PyTuple_New(
+                nargs_in > nargs_pos ? (Py_ssize_t) (nargs_in - nargs_pos) : 0);
 
-                if (has_args) {
-                    const arg_data &ad = f->args[i];
-
-                    if (kwargs_in && ad.name_py) {
-                        PyObject *hit = nullptr;
-                        for (size_t j = 0; j < nkwargs_in; ++j) {
-                            if (kwnames[j] == ad.name_py) {
-                                hit = args_in[nargs_in + j];
-                                kwarg_used[j] = true;
-                                break;
-                            }
-                        }
+            for (size_t j = nargs_pos; j < nargs_in; ++j) {
+                PyObject *o = args_in[j];
+                NB_TUPLE_SET_ITEM(tuple, (Py_ssize_t) (j - nargs_pos),
+                                  Py_NewRef(o));
+            }
 
-                        if (hit) {
-                            if (arg)
-                                break; // conflict between keyword and positional arg.
-                            arg = hit;
-                        }
-                    }
+            args[nargs_pos] = tuple;
+            cleanup.append(tuple);
+        }
 
-                    if (!arg)
-                        arg = ad.value;
-                    arg_flag = ad.flag;
+        // Deal with remaining keyword arguments
+        if (has_var_kwargs) {
+            if (kw_slot) {
+                memset(kwarg_used, 0, nkwargs_in * sizeof(bool));
+                for (size_t j = 0; j < nargs_step1; ++j) {
+                    if (kw_slot[j] != NB_KW_NONE)
+                        kwarg_used[kw_slot[j]] = true;
                 }
+            }
 
-                if (!arg || (arg == none_ptr() && (arg_flag & cast_flags::accepts_none) == 0))
-                    break;
-
-                args[i] = arg;
+            PyObject *dict = PyDict_New();
+            for (size_t j = 0; j < nkwargs_in; ++j) {
+                PyObject *key = kwnames[j];
+                if (!kwarg_used[j])
+                    PyDict_SetItem(dict, key, args_in[nargs_in + j]);
             }
 
-            // Skip this overload if any arguments were unavailable
-            if (i != nargs_step1)
+            args[nargs_step1] = dict;
+            cleanup.append(dict);
+        } else if (kwargs_in && !kw_slot) {
+            bool success = true;
+            for (size_t j = 0; j < nkwargs_in; ++j)
+                success &= kwarg_used[j];
+            if (!success)
                 continue;
+        }
 
-            // Deal with remaining positional arguments
-            if (has_var_args) {
-                PyObject *tuple = PyTuple_New(
-                    nargs_in > nargs_pos ? (Py_ssize_t) (nargs_in - nargs_pos) : 0);
 
-                for (size_t j = nargs_pos; j < nargs_in; ++j) {
-                    PyObject *o = args_in[j];
-                    NB_TUPLE_SET_ITEM(tuple, (Py_ssize_t) (j - nargs_pos),
-                                      Py_NewRef(o));
-                }
+        // A constructor's 'self' may also arrive as a keyword argument,
+        // so it must be read back from args[0] rather than from args_in[0]
+        PyObject *self_arg_constructor = nullptr;
+        if (is_constructor) {
+            self_arg_constructor = args[0];
+        }
 
-                args[nargs_pos] = tuple;
-                cleanup.append(tuple);
-            }
+        invoked++;
 
-            // Deal with remaining keyword arguments
-            if (has_var_kwargs) {
-                PyObject *dict = PyDict_New();
-                for (size_t j = 0; j < nkwargs_in; ++j) {
-                    PyObject *key = kwnames[j];
-                    if (!kwarg_used[j])
-                        PyDict_SetItem(dict, key, args_in[nargs_in + j]);
-                }
-
-                args[nargs_step1] = dict;
-                cleanup.append(dict);
-            } else if (kwargs_in) {
-                bool success = true;
-                for (size_t j = 0; j < nkwargs_in; ++j)
-                    success &= kwarg_used[j];
-                if (!success)
-                    continue;
-            }
+        try {
+            result = nullptr;
 
+            // Found a suitable overload, let's try calling it
+            result = f->impl(
+                (void *) f->capture, args,
+                func_dispatch_flags(
+                    f, pass != 0, is_constructor,
+                    (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
+                &cleanup);
 
-            // A constructor's 'self' may also arrive as a keyword argument,
-            // so it must be read back from args[0] rather than from args_in[0]
-            PyObject *self_arg_constructor = nullptr;
-            if (is_constructor) {
-                self_arg_constructor = args[0];
-            }
+            if (NB_UNLIKELY(!result))
+                error_handler = nb_func_error_noconvert;
+        } catch (builtin_exception &e) {
+            if (!set_builtin_exception_status(e))
+                result = NB_NEXT_OVERLOAD;
+        } catch (python_error &e) {
+            e.restore();
+        } catch (...) {
+            nb_func_convert_cpp_exception(self);
+        }
 
-            try {
-                result = nullptr;
-
-                // Found a suitable overload, let's try calling it
-                result = f->impl(
-                    (void *) f->capture, args,
-                    func_dispatch_flags(
-                        f, pass != 0, is_constructor,
-                        (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
-                    &cleanup);
-
-                if (NB_UNLIKELY(!result))
-                    error_handler = nb_func_error_noconvert;
-            } catch (builtin_exception &e) {
-                if (!set_builtin_exception_status(e))
-                    result = NB_NEXT_OVERLOAD;
-            } catch (python_error &e) {
-                e.restore();
-            } catch (...) {
-                nb_func_convert_cpp_exception(self);
+        if (result != NB_NEXT_OVERLOAD) {
+            if (is_constructor && result != nullptr) {
+                nb_inst *self_arg_nb = (nb_inst *) self_arg_constructor;
+                self_arg_nb->state.destruct = true;
+                self_arg_nb->state.state = nb_inst_state::state_ready;
+                if (NB_UNLIKELY(self_arg_nb->state.intrusive))
+                    nb_type_data(Py_TYPE(self_arg_constructor))
+                        ->set_self_py(inst_ptr(self_arg_nb), self_arg_constructor);
             }
 
-            if (result != NB_NEXT_OVERLOAD) {
-                if (is_constructor && result != nullptr) {
-                    nb_inst *self_arg_nb = (nb_inst *) self_arg_constructor;
-                    self_arg_nb->state.destruct = true;
-                    self_arg_nb->state.state = nb_inst_state::state_ready;
-                    if (NB_UNLIKELY(self_arg_nb->state.intrusive))
-                        nb_type_data(Py_TYPE(self_arg_constructor))
-                            ->set_self_py(inst_ptr(self_arg_nb), self_arg_constructor);
-                }
+            // Only memoize the first candidate whose implementation ran.
+            // The overloads skipped before it were rejected based on the
+            // number, names, and 'None'-ness of the arguments, which the
+            // cache key captures. Other rejections may depend on the
+            // argument values, as may an overload that raised.
+            if (use_cache && pos != hint && result && invoked == 1)
+                nb_ov_cache_store((nb_func *) self, ov_key, pos);
 
-                goto done;
-            }
+            goto done;
         }
     }
 
@@ -961,91 +1350,118 @@ nb_func_vectorcall_medium_pos(PyObject *self, PyObject *const *args_in,
 
     PyObject *args[NB_MAXARGS_SIMPLE];
 
-    for (size_t pass = (count > 1) ? 0 : 1; pass < 2; ++pass) {
-        for (size_t k = 0; k < count; ++k) {
-            const func_data *f = fr + k;
-            const bool has_args = f->flags & (uint32_t) func_flags::has_args;
-            const size_t nargs = f->nargs;
-
-            if (nargs_in > f->nargs_pos)
-                continue; // Too many positional arguments given for this overload
-
-            if (nargs_in < nargs && !has_args)
-                continue; // Not enough positional arguments, no defaults available
-
-            // Copy positional arguments, substitute defaults for the rest.
-            // Parameters at index >= nargs_pos (keyword-only) always take the
-            // default branch here since nargs_in <= nargs_pos was checked above.
-            size_t i = 0;
-            if (NB_LIKELY(nargs_in == nargs)) {
-                // No defaults needed. Only consult 'args' if one of the
-                // arguments is None
-                for (; i < nargs; ++i) {
-                    PyObject *arg = args_in[i];
-
-                    if (NB_UNLIKELY(arg == none_ptr()) &&
-                        (!has_args ||
-                         (f->args[i].flag & cast_flags::accepts_none) == 0))
-                        break;
-
-                    args[i] = arg;
-                }
-            } else for (; i < nargs; ++i) {
-                PyObject *arg = i < nargs_in ? args_in[i] : nullptr;
-                uint32_t arg_flag = 0;
-
-                if (has_args) {
-                    const arg_data &ad = f->args[i];
-                    if (!arg)
-                        arg = ad.value;
-                    arg_flag = ad.flag;
-                }
-
-                if (!arg || (arg == none_ptr() &&
-                             (arg_flag & cast_flags::accepts_none) == 0))
+    // Try the candidate memoized by the overload resolution cache first
+    nb_ov_key ov_key;
+    const bool use_cache =
+        ((nb_func *) self)->cache_overloads &&
+        nb_ov_key_init(ov_key, args_in, nargs_in, nullptr);
+    const size_t hint =
+        use_cache ? nb_ov_cache_lookup((nb_func *) self, ov_key) : NB_OV_NONE;
+
+    // Number of candidates whose implementation was called
+    size_t invoked = 0;
+
+    for (size_t step = 0, steps = nb_ov_steps(count, hint); step < steps;
+         ++step) {
+        const size_t pos  = nb_ov_pos(step, count, hint),
+                     pass = pos >= count,
+                     k    = pos - pass * count;
+
+        if (NB_UNLIKELY(pos == hint) && step != 0)
+            continue; // the cached candidate declined already
+
+        const func_data *f = fr + k;
+        const bool has_args = f->flags & (uint32_t) func_flags::has_args;
+        const size_t nargs = f->nargs;
+
+        if (nargs_in > f->nargs_pos)
+            continue; // Too many positional arguments given for this overload
+
+        if (nargs_in < nargs && !has_args)
+            continue; // Not enough positional arguments, no defaults available
+
+        // Copy positional arguments, substitute defaults for the rest.
+        // Parameters at index >= nargs_pos (keyword-only) always take the
+        // default branch here since nargs_in <= nargs_pos was checked above.
+        size_t i = 0;
+        if (NB_LIKELY(nargs_in == nargs)) {
+            // No defaults needed. Only consult 'args' if one of the
+            // arguments is None
+            for (; i < nargs; ++i) {
+                PyObject *arg = args_in[i];
+
+                if (NB_UNLIKELY(arg == none_ptr()) &&
+                    (!has_args ||
+                     (f->args[i].flag & cast_flags::accepts_none) == 0))
                     break;
 
                 args[i] = arg;
             }
+        } else for (; i < nargs; ++i) {
+            PyObject *arg = i < nargs_in ? args_in[i] : nullptr;
+            uint32_t arg_flag = 0;
+
+            if (has_args) {
+                const arg_data &ad = f->args[i];
+                if (!arg)
+                    arg = ad.value;
+                arg_flag = ad.flag;
+            }
 
-            // Skip this overload if any arguments were unavailable
-            if (i != nargs)
-                continue;
+            if (!arg || (arg == none_ptr() &&
+                         (arg_flag & cast_flags::accepts_none) == 0))
+                break;
 
-            try {
-                result = nullptr;
-
-                // Found a suitable overload, let's try calling it
-                result = f->impl(
-                    (void *) f->capture, args,
-                    func_dispatch_flags(
-                        f, pass != 0, is_constructor,
-                        (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
-                    &cleanup);
-
-                if (NB_UNLIKELY(!result))
-                    error_handler = nb_func_error_noconvert;
-            } catch (builtin_exception &e) {
-                if (!set_builtin_exception_status(e))
-                    result = NB_NEXT_OVERLOAD;
-            } catch (python_error &e) {
-                e.restore();
-            } catch (...) {
-                nb_func_convert_cpp_exception(self);
-            }
+            args[i] = arg;
+        }
 
-            if (result != NB_NEXT_OVERLOAD) {
-                if (is_constructor && result != nullptr) {
-                    nb_inst *self_arg_nb = (nb_inst *) self_arg;
-                    self_arg_nb->state.destruct = true;
-                    self_arg_nb->state.state = nb_inst_state::state_ready;
-                    if (NB_UNLIKELY(self_arg_nb->state.intrusive))
-                        nb_type_data(Py_TYPE(self_arg))
-                            ->set_self_py(inst_ptr(self_arg_nb), self_arg);
-                }
+        // Skip this overload if any arguments were unavailable
+        if (i != nargs)
+            continue;
+
+        invoked++;
+
+        try {
+            result = nullptr;
+
+            // Found a suitable overload, let's try calling it
+            result = f->impl(
+                (void *) f->capture, args,
+                func_dispatch_flags(
+                    f, pass != 0, is_constructor,
+                    (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
+                &cleanup);
 
-                goto done;
+            if (NB_UNLIKELY(!result))
+                error_handler = nb_func_error_noconvert;
+        } catch (builtin_exception &e) {
+            if (!set_builtin_exception_status(e))
+                result = NB_NEXT_OVERLOAD;
+        } catch (python_error &e) {
+            e.restore();
+        } catch (...) {
+            nb_func_convert_cpp_exception(self);
+        }
+
+        if (result != NB_NEXT_OVERLOAD) {
+            if (is_constructor && result != nullptr) {
+                nb_inst *self_arg_nb = (nb_inst *) self_arg;
+                self_arg_nb->state.destruct = true;
+                self_arg_nb->state.state = nb_inst_state::state_ready;
+                if (NB_UNLIKELY(self_arg_nb->state.intrusive))
+                    nb_type_data(Py_TYPE(self_arg))
+                        ->set_self_py(inst_ptr(self_arg_nb), self_arg);
             }
+
+            // Only memoize the first candidate whose implementation ran.
+            // The overloads skipped before it were rejected based on the
+            // number, names, and 'None'-ness of the arguments, which the
+            // cache key captures. Other rejections may depend on the
+            // argument values, as may an overload that raised.
+            if (use_cache && pos != hint && result && invoked == 1)
+                nb_ov_cache_store((nb_func *) self, ov_key, pos);
+
+            goto done;
         }
     }
 
@@ -1098,6 +1514,17 @@ static PyObject *nb_func_vectorcall_simple(PyObject *self,
     PyObject *(*error_handler)(PyObject *, PyObject *const *, size_t,
                                PyObject *) noexcept = nullptr;
 
+    // Try the candidate memoized by the overload resolution cache first
+    nb_ov_key ov_key;
+    const bool use_cache =
+        ((nb_func *) self)->cache_overloads &&
+        nb_ov_key_init(ov_key, args_in, nargs_in, nullptr);
+    const size_t hint =
+        use_cache ? nb_ov_cache_lookup((nb_func *) self, ov_key) : NB_OV_NONE;
+
+    // Number of candidates whose implementation was called
+    size_t invoked = 0;
+
     bool fail = kwargs_in != nullptr;
     PyObject *none = none_ptr();
     for (size_t i = 0; i < nargs_in; ++i)
@@ -1108,47 +1535,63 @@ static PyObject *nb_func_vectorcall_simple(PyObject *self,
         goto done;
     }
 
-    for (size_t pass = (count > 1) ? 0 : 1; pass < 2; ++pass) {
-        for (size_t k = 0; k < count; ++k) {
-            const func_data *f = fr + k;
+    for (size_t step = 0, steps = nb_ov_steps(count, hint); step < steps;
+         ++step) {
+        const size_t pos  = nb_ov_pos(step, count, hint),
+                     pass = pos >= count,
+                     k    = pos - pass * count;
 
-            if (nargs_in != f->nargs)
-                continue;
+        if (NB_UNLIKELY(pos == hint) && step != 0)
+            continue; // the cached candidate declined already
 
-            try {
-                result = nullptr;
-
-                // Found a suitable overload, let's try calling it
-                result = f->impl(
-                    (void *) f->capture, (PyObject **) args_in,
-                    func_dispatch_flags(
-                        f, pass != 0, is_constructor,
-                        (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
-                    &cleanup);
-
-                if (NB_UNLIKELY(!result))
-                    error_handler = nb_func_error_noconvert;
-            } catch (builtin_exception &e) {
-                if (!set_builtin_exception_status(e))
-                    result = NB_NEXT_OVERLOAD;
-            } catch (python_error &e) {
-                e.restore();
-            } catch (...) {
-                nb_func_convert_cpp_exception(self);
-            }
+        const func_data *f = fr + k;
 
-            if (result != NB_NEXT_OVERLOAD) {
-                if (is_constructor && result != nullptr) {
-                    nb_inst *self_arg_nb = (nb_inst *) self_arg;
-                    self_arg_nb->state.destruct = true;
-                    self_arg_nb->state.state = nb_inst_state::state_ready;
-                    if (NB_UNLIKELY(self_arg_nb->state.intrusive))
-                        nb_type_data(Py_TYPE(self_arg))
-                            ->set_self_py(inst_ptr(self_arg_nb), self_arg);
-                }
+        if (nargs_in != f->nargs)
+            continue;
+
+        invoked++;
+
+        try {
+            result = nullptr;
+
+            // Found a suitable overload, let's try calling it
+            result = f->impl(
+                (void *) f->capture, (PyObject **) args_in,
+                func_dispatch_flags(
+                    f, pass != 0, is_constructor,
+                    (nargsf & NB_VECTORCALL_TRUSTED_SELF) != 0),
+                &cleanup);
+
+            if (NB_UNLIKELY(!result))
+                error_handler = nb_func_error_noconvert;
+        } catch (builtin_exception &e) {
+            if (!set_builtin_exception_status(e))
+                result = NB_NEXT_OVERLOAD;
+        } catch (python_error &e) {
+            e.restore();
+        } catch (...) {
+            nb_func_convert_cpp_exception(self);
+        }
 
-                goto done;
+        if (result != NB_NEXT_OVERLOAD) {
+            if (is_constructor && result != nullptr) {
+                nb_inst *self_arg_nb = (nb_inst *) self_arg;
+                self_arg_nb->state.destruct = true;
+                self_arg_nb->state.state = nb_inst_state::state_ready;
+                if (NB_UNLIKELY(self_arg_nb->state.intrusive))
+                    nb_type_data(Py_TYPE(self_arg))
+                        ->set_self_py(inst_ptr(self_arg_nb), self_arg);
             }
+
+            // Only memoize the first candidate whose implementation ran.
+            // The overloads skipped before it were rejected based on the
+            // number, names, and 'None'-ness of the arguments, which the
+            // cache key captures. Other rejections may depend on the
+            // argument values, as may an overload that raised.
+            if (use_cache && pos != hint && result && invoked == 1)
+                nb_ov_cache_store((nb_func *) self, ov_key, pos);
+
+            goto done;
         }
     }
 
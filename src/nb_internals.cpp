@@ -205,6 +205,12 @@ static void nb_thread_state_destroy(void *p) noexcept {
         }
     }
 
+    if (cleanup_guard guard{})
+        nb_ndarray_exports_clear(ts->ndarray_exports);
+
+    nb_ndarray_pool_drain(&ts->ndarray_pool);
+    nb_ndarray_alloc_pool_drain(&ts->ndarray_alloc_pool);
+
     if (nb_thread_state_tls == ts)
         nb_thread_state_tls = nullptr;
     delete ts;
@@ -673,6 +679,7 @@ static void internals_release_types(nb_internals *p) {
         (PyObject *) p->nb_method,
         (PyObject *) p->nb_bound_method,
         (PyObject *) p->nb_static_property.load_relaxed(),
+        (PyObject *) p->nb_member.load_relaxed(),
         (PyObject *) p->nb_ndarray.load_relaxed()
     };
 
@@ -695,12 +702,19 @@ void internals_dec_ref(nb_internals *p) {
 
     internals_release_types(p);
 
+#if !defined(NB_FREE_THREADED)
+    // The weak references of the export cache can't be released by
+    // internals_cleanup(), which runs without a thread state
+    nb_ndarray_exports_clear(p->ndarray_exports);
+#endif
+
     p->nb_module = nullptr;
     p->nb_type = nullptr;
     p->nb_func = nullptr;
     p->nb_method = nullptr;
     p->nb_bound_method = nullptr;
     p->nb_static_property.store_release(nullptr);
+    p->nb_member.store_release(nullptr);
     p->nb_ndarray.store_release(nullptr);
     for (auto &entry : p->ndarray_export)
         entry.store_release(nullptr);
@@ -880,6 +894,11 @@ NB_NOINLINE static void internals_cleanup_one(nb_internals *p) {
             nb_pool_drain(&td->pool, /* can_free = */ false);
     }
 
+    // Release recycled ndarray handles and storage (these don't need a
+    // thread state)
+    nb_ndarray_pool_drain(&p->ndarray_pool);
+    nb_ndarray_alloc_pool_drain(&p->ndarray_alloc_pool);
+
     size_t inst_leaks = 0, keep_alive_leaks = 0;
 
     // Shard locking no longer needed, Py_AtExit is single-threaded
@@ -1063,6 +1082,120 @@ static void internals_discard(nb_internals *p) noexcept {
     delete p;
 }
 
+#if defined(NB_FREE_THREADED)
+/// Upper bound of the shard count
+static constexpr size_t nb_shard_count_max = 4096;
+
+/// Number of CPUs available to the process (os.process_cpu_count()), or 0
+static size_t cpu_count() noexcept {
+    size_t result = 0;
+    PyObject *os = PyImport_ImportModule("os");
+    if (os) {
+        PyObject *count = PyObject_CallMethod(os, "process_cpu_count", nullptr);
+        if (count && count != Py_None)
+            result = PyLong_AsSize_t(count);
+        Py_XDECREF(count);
+        Py_DECREF(os);
+    }
+    if (PyErr_Occurred()) {
+        PyErr_Clear();
+        result = 0;
+    }
+    return result;
+}
+
+/// Select the size of 'nb_internals::shards'. The environment variable
+/// 'NB_SHARD_COUNT' specifies it explicitly. Otherwise, or when it is set to
+/// 'auto', the count is twice the number of CPUs available to the process.
+/// The result is rounded up to a power of two.
+static size_t shard_count_select() noexcept {
+    size_t count = 0;
+
+    const char *env = getenv("NB_SHARD_COUNT");
+    if (env && *env && strcmp(env, "auto") != 0) {
+        char *end = nullptr;
+        unsigned long long value = strtoull(env, &end, 10);
+        if (*end == '\0' && value > 0 && value <= nb_shard_count_max) {
+            count = (size_t) value;
+        } else if (PyErr_WarnFormat(PyExc_RuntimeWarning, 1,
+                                    "nanobind: ignoring invalid NB_SHARD_COUNT "
+                                    "value \"%s\" (expected \"auto\" or an "
+                                    "integer between 1 and %zu)",
+                                    env, nb_shard_count_max)) {
+            warning_failed();
+        }
+    }
+
+    if (!count) {
+        size_t cpus = cpu_count();
+        if (!cpus)
+            cpus = std::thread::hardware_concurrency();
+        count = cpus ? 2 * cpus : 2;
+        if (count > nb_shard_count_max)
+            count = nb_shard_count_max;
+    }
+
+    size_t result = 1;
+    while (result < count)
+        result *= 2;
+    return result;
+}
+#endif
+
+#if defined(NB_FREE_THREADED)
+void nb_shard_lock_counted(nb_shard &s) noexcept {
+    bool contended = s.lock_users.fetch_add(1, std::memory_order_relaxed) != 0;
+    PyMutex_Lock(&s.mutex);
+
+    // Written under the lock, read concurrently by nb::shard_stats()
+    auto incr = [](uint64_t &value) {
+        std::atomic<uint64_t> &a = *(std::atomic<uint64_t> *) &value;
+        a.store(a.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    };
+    incr(s.lock_count);
+    if (NB_UNLIKELY(contended))
+        incr(s.lock_contended);
+}
+#endif
+
+PyObject *nb_shard_stats(nb_internals *p) noexcept {
+    size_t n = p->shard_count;
+    PyObject *result = PyDict_New(),
+             *count = PyLong_FromSize_t(n),
+             *locks = PyList_New((Py_ssize_t) n),
+             *contended = PyList_New((Py_ssize_t) n);
+
+    bool ok = result && count && locks && contended;
+    for (size_t i = 0; ok && i < n; ++i) {
+        uint64_t l = 0, c = 0;
+#if defined(NB_FREE_THREADED)
+        auto load = [](uint64_t &value) {
+            return ((std::atomic<uint64_t> *) &value)->load(std::memory_order_relaxed);
+        };
+        l = load(p->shards[i].lock_count);
+        c = load(p->shards[i].lock_contended);
+#endif
+        PyObject *lo = PyLong_FromUnsignedLongLong(l),
+                 *co = PyLong_FromUnsignedLongLong(c);
+        if (lo)
+            NB_LIST_SET_ITEM(locks, (Py_ssize_t) i, lo);
+        if (co)
+            NB_LIST_SET_ITEM(contended, (Py_ssize_t) i, co);
+        ok = lo && co;
+    }
+
+    ok = ok && !PyDict_SetItemString(result, "count", count) &&
+         !PyDict_SetItemString(result, "locks", locks) &&
+         !PyDict_SetItemString(result, "contended", contended);
+
+    Py_XDECREF(count);
+    Py_XDECREF(locks);
+    Py_XDECREF(contended);
+    if (!ok)
+        Py_CLEAR(result);
+    return result;
+}
+
 static nb_internals *nb_module_init_impl(const char *domain, PyObject *m) {
 #if defined(NB_HAVE_INTERP_VIEW)
     // Needed by every later attach_tstate() call, including those of
@@ -1129,13 +1262,11 @@ static nb_internals *nb_module_init_impl(const char *domain, PyObject *m) {
     }
 
     nb_internals *p = new nb_internals();
+    nb_type_epoch_bump(p);
 
     size_t shard_count = 1;
 #if defined(NB_FREE_THREADED)
-    size_t hw_concurrency = std::thread::hardware_concurrency();
-    while (shard_count < hw_concurrency)
-        shard_count *= 2;
-    shard_count *= 2;
+    shard_count = shard_count_select();
     p->shards = new nb_shard[shard_count];
     p->shard_mask = shard_count - 1;
 
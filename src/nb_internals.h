@@ -76,7 +76,7 @@
 /// backends from each other instead of breaking them: their type universes
 /// simply become disjoint.
 #ifndef NB_INTERNALS_VERSION
-#  define NB_INTERNALS_VERSION 22
+#  define NB_INTERNALS_VERSION 23
 #endif
 
 /// Backends compiled under the limited API cache type slots and lay out
@@ -238,7 +238,13 @@ enum class type_flags_internal : uint32_t {
 
     /// Does the type implement a custom __new__ operator that can take no
     /// args (except the type object)?
-    has_nullary_new          = (1 << 28)
+    has_nullary_new          = (1 << 28),
+
+    /// Do instances with internal storage use the compact layout? This applies
+    /// to all types with an alignment of at most 4 bytes, regardless of their
+    /// size or copy semantics. Their data then overlaps the 'nb_inst::offset'
+    /// field, which saves space and the indirection through the offset.
+    is_compact               = (1 << 29)
 };
 
 struct nb_alias_chain;
@@ -249,6 +255,57 @@ struct nb_inst_pool {
     nb_inst **slots;
     uint32_t count;
     uint32_t capacity;
+
+    /// Number of pool events (allocations and releases) in the current
+    /// observation window, and the smallest value of 'count' during it. At the
+    /// end of a window, nb_pool_adapt() resizes the pool if needed.
+    uint32_t events;
+    uint32_t low_water;
+
+    /// Event counters of the current window (see 'nb_pool_stats')
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    /// Value of 'events' at the last idle sweep, or UINT32_MAX if a window
+    /// ended since then (see nb_pool_sweep())
+    uint32_t idle_mark;
+};
+
+/// Free lists of ndarray handle blocks for arrays with up to 4 and up to 8
+/// dimensions (see 'ndarray_block' in nb_ndarray.cpp). Each free block stores
+/// a pointer to the next one in its first word.
+struct nb_ndarray_pool {
+    void *head[2];
+    uint32_t count[2];
+};
+
+/// Free lists of blocks returned by the 'ndarray_alloc' slot, indexed by
+/// their size class (a power of two, see nb_ndarray.cpp)
+struct nb_ndarray_alloc_pool {
+    void *head[13];
+    uint32_t count[13];
+
+    /// Total size of the blocks in all lists
+    size_t bytes;
+};
+
+/// Per-type instance pool statistics. In free-threaded builds, the per-thread
+/// pools add their counters at the end of each observation window.
+struct nb_pool_stats {
+    /// Allocations served from a pool
+    uint64_t hits;
+
+    /// Allocations that found the pool empty
+    uint64_t misses;
+
+    /// Released instances that were freed since their pool was full, or
+    /// that a shrinking pool gave up
+    uint64_t evictions;
+
+    /// Number of times that a pool grew or shrank
+    uint64_t grows;
+    uint64_t shrinks;
 };
 
 // Implicit conversions for C++ type bindings, used in type_data below
@@ -344,6 +401,9 @@ struct type_data {
     /// Per-type instance pool for non-FT builds
     nb_inst_pool pool;
 #endif
+
+    /// Instance pool statistics (see nb::type_pool_stats())
+    nb_pool_stats pool_stats;
 };
 
 /// Runtime record for enumeration bindings; extends the private type record
@@ -384,16 +444,23 @@ struct nb_inst_state {
     /// Does this instance use intrusive reference counting?
     uint8_t intrusive : 1;
 
-    /// Currently not used (but needed to pad to 8 bit)
-    uint8_t pad : 1;
+    /// Is this a compact instance? (see 'type_flags_internal::is_compact').
+    /// The instance data then starts at the 'offset' field of 'nb_inst'.
+    uint8_t compact : 1;
 
-    /// Does this instance hold references to others? (via internals.keep_alive)
+    // Bits of the 'clear_keep_alive' field
+    static constexpr uint8_t keep_alive_map = 1;    // internals.keep_alive
+    static constexpr uint8_t keep_alive_inline = 2; // nb_inst_keep_alive_slot()
+
+    /// Does this instance hold references to others? (see 'keep_alive_*')
     /// This may be accessed concurrently to the flag byte above, so it is kept
     /// in its own byte (never read-modify-written together with the flags).
     uint8_t clear_keep_alive;
 
-    // That's a lot of unused space. I wonder if there is a good use for it..
-    uint16_t unused;
+    /// Does the object have an inline keep-alive slot? Set at allocation.
+    uint8_t keep_alive_slot;
+
+    uint8_t unused;
 };
 
 static_assert(sizeof(nb_inst_state) == sizeof(uint32_t));
@@ -402,15 +469,26 @@ static_assert(sizeof(nb_inst_state) == sizeof(uint32_t));
 struct nb_inst { // usually: 24 bytes
     PyObject_HEAD
 
-    /// Offset to the actual instance data
-    int32_t offset;
-
     /// Packed status flags (see nb_inst_state)
     nb_inst_state state;
+
+    /// Offset to the actual instance data. Compact instances store their
+    /// data here instead.
+    int32_t offset;
 };
 
 static_assert(sizeof(nb_inst) == sizeof(PyObject) + sizeof(uint32_t) * 2);
 
+/// Inline keep-alive slot of an instance with 'state.keep_alive_slot' set.
+/// Non-GC instances referencing external data reserve a word after 'nb_inst',
+/// which stores the data pointer instead when 'offset' cannot encode it. The
+/// slot holds the first patient of 'keep_alive_py()' so that the common case
+/// of one patient (e.g., 'rv_policy::reference_internal') needs neither a
+/// record in 'nb_shard::keep_alive' nor the shard lock.
+inline PyObject *&nb_inst_keep_alive_slot(nb_inst *self) noexcept {
+    return *(PyObject **) (self + 1);
+}
+
 /// Helper to ensure that nb_inst instance state updates produce one 4-byte store
 inline void nb_inst_state_write(nb_inst *self, nb_inst_state state) noexcept {
     uint32_t w;
@@ -418,6 +496,42 @@ inline void nb_inst_state_write(nb_inst *self, nb_inst_state state) noexcept {
     std::memcpy(&self->state, &w, sizeof(w));
 }
 
+/**
+ * Wraps a std::atomic if free-threading is enabled, otherwise a raw value.
+ */
+#if defined(NB_FREE_THREADED)
+template<typename T>
+struct nb_maybe_atomic {
+  nb_maybe_atomic(T v = T()) : value(v) {}
+
+  std::atomic<T> value;
+  T load_acquire() { return value.load(std::memory_order_acquire); }
+  T load_relaxed() { return value.load(std::memory_order_relaxed); }
+  void store_release(T w) { value.store(w, std::memory_order_release); }
+  void store_relaxed(T w) { value.store(w, std::memory_order_relaxed); }
+};
+#else
+template<typename T>
+struct nb_maybe_atomic {
+  nb_maybe_atomic(T v = T()) : value(v) {}
+
+  T value;
+  T load_acquire() { return value; }
+  T load_relaxed() { return value; }
+  void store_release(T w) { value = w; }
+  void store_relaxed(T w) { value = w; }
+};
+#endif
+
+/// Overload resolution cache of an 'nb_func' (see nb_func.cpp)
+struct nb_ov_cache;
+
+/// Precomputed keyword argument matching of an 'nb_func' (see nb_func.cpp)
+struct nb_kw_plan;
+
+/// Number of keyword argument plans stored per 'nb_func'
+#define NB_KW_PLANS 4
+
 /// Dispatcher needed by an overload chain; chain merging takes the maximum
 enum class call_complexity : uint8_t {
     /// No named/default/flagged arguments: nb_func_vectorcall_simple*
@@ -438,9 +552,13 @@ struct nb_func {
     uint32_t max_nargs; // maximum value of func_data::nargs for any overload
     call_complexity complexity;
     bool doc_uniform;
+    bool cache_overloads; // memoize overload resolution (nb::cache_overloads)
     nb_internals *internals; // backend state of the domain that owns this function
     PyObject *scope; // borrowed; the scope owns this function
     PyObject *module_name; // '__module__' captured at definition time
+    nb_maybe_atomic<nb_ov_cache *> ov_cache; // created on first use (or null)
+    nb_maybe_atomic<nb_kw_plan *> kw_plans[NB_KW_PLANS]; // keyword call plans
+    nb_maybe_atomic<PyObject *> kw_pending; // name tuple awaiting a plan (or null)
 };
 
 /// Python object representing a `nb_ndarray` (which wraps a DLPack ndarray)
@@ -530,6 +648,49 @@ struct std_typeinfo_eq {
 using nb_ptr_map  = tsl::robin_map<void *, void*, ptr_hash>;
 
 using nb_type_map_fast = nb_ptr_map;
+
+/// Properties of a Python type that determine how ndarray_import() and
+/// ndarray_check() treat its instances (see nb_ndarray.cpp)
+struct nb_ndarray_type_info {
+    /// Value of 'tp_version_tag' when the entry was created. Deallocating or
+    /// modifying the type invalidates the tag, and with it the entry.
+    uint32_t version;
+
+    /// Framework detected from the '__module__' attribute
+    uint8_t framework;
+
+    /// Does the type have a '__dlpack__' method, support the buffer
+    /// protocol, or have the name of a known array type?
+    bool has_dlpack : 1;
+    bool has_buffer : 1;
+    bool is_array_type : 1;
+};
+
+using nb_ndarray_type_map =
+    tsl::robin_map<void *, nb_ndarray_type_info, ptr_hash>;
+
+/// Description of an array exported by ndarray_export(), compared bitwise
+struct nb_ndarray_export_key {
+    void *data;
+    PyObject *owner;
+    uint64_t byte_offset;
+    int64_t shape[4], strides[4];
+    int32_t ndim, device_type, device_id;
+    uint32_t dtype; // code | bits << 8 | lanes << 16
+    int32_t framework;
+    uint32_t ro;
+};
+
+/// Weak reference to the object created by a previous export
+struct nb_ndarray_export_entry {
+    nb_ndarray_export_key key;
+    PyObject *weakref;
+};
+
+/// Export cache indexed by the hash of 'nb_ndarray_export_key'
+using nb_ndarray_export_map =
+    tsl::robin_map<uint64_t, nb_ndarray_export_entry>;
+
 using nb_type_map_slow = tsl::robin_map<const std::type_info *, type_data *,
                                         std_typeinfo_hash, std_typeinfo_eq>;
 
@@ -542,12 +703,27 @@ struct nb_thread_state {
     // C++ -> Python type cache
     nb_type_map_fast type_c2p_fast;
 
+    // Properties of types passed to ndarray_import()
+    nb_ndarray_type_map ndarray_types;
+
     /// Per-thread instance pools indexed by ``type_data::pool_index``
     /// Grown lazily by nb_pool_ensure() and freed when the thread exists
     nb_inst_pool *pools = nullptr;
 
     /// Number of entries currently allocated in ``pools``
     uint32_t pools_size = 0;
+
+    /// Number of completed observation windows of this thread's pools
+    uint32_t pool_windows = 0;
+
+    /// Recycled ndarray handles
+    nb_ndarray_pool ndarray_pool { };
+
+    /// Objects created by recent ndarray exports
+    nb_ndarray_export_map ndarray_exports;
+
+    /// Recycled ndarray storage
+    nb_ndarray_alloc_pool ndarray_alloc_pool { };
 };
 
 /// One-entry cache holding the most recently used domain's thread state
@@ -575,6 +751,221 @@ NB_INLINE void*        nb_mark_seq(void *p) { return (void *) (((uintptr_t) p) |
 /// Retrieve the nb_inst_seq* pointer from an 'inst_c2p' value
 NB_INLINE nb_inst_seq* nb_get_seq(void *p)  { return (nb_inst_seq *) (((uintptr_t) p) ^ 1); }
 
+#if defined(NB_FREE_THREADED)
+/* In free-threaded builds, 'nb_shard::inst_c2p' uses the following hash table
+   instead of 'nb_ptr_map'. It mirrors the parts of the tsl::robin_map
+   interface used by nanobind, which require the shard lock. In addition,
+   'lookup()' reads the table without taking the lock.
+
+   The table uses linear probing. Erasing an entry shifts later entries of the
+   probe sequence backwards instead of leaving a tombstone, so a steady churn
+   of instances never fills the table. A concurrent lookup can therefore miss
+   an entry that is being moved. Callers treat a miss as inconclusive and
+   repeat the lookup with the lock held.
+
+   Slots are updated following the seqlock pattern: the writer replaces the
+   key by 'busy' before changing the value and stores the final key last.
+   Readers only accept a value if the key is unchanged after loading it.
+
+   Growing the table publishes a new slot array. Readers may still traverse
+   the old one, which is therefore retired instead of freed and released
+   along with the map. Since each array is twice the size of its
+   predecessor, retired arrays use less memory than the current one. */
+class nb_inst_map {
+public:
+    /// Key/value pair of the table
+    struct slot {
+        void *first;
+        void *second;
+    };
+
+    /// Assignable reference to the value of a slot (see 'iterator::value()')
+    struct value_ref {
+        slot *s;
+        void *operator=(void *value) const {
+            cell(s->second).store(value, std::memory_order_release);
+            return value;
+        }
+    };
+
+    class iterator {
+    public:
+        iterator(slot *s, slot *end) : s(s), e(end) { skip(); }
+        slot &operator*() const { return *s; }
+        slot *operator->() const { return s; }
+        value_ref value() const { return { s }; }
+        iterator &operator++() { ++s; skip(); return *this; }
+        bool operator==(const iterator &o) const { return s == o.s; }
+        bool operator!=(const iterator &o) const { return s != o.s; }
+
+    private:
+        friend class nb_inst_map;
+        void skip() { while (s != e && !used(s->first)) ++s; }
+        slot *s, *e;
+    };
+
+    nb_inst_map() = default;
+    nb_inst_map(const nb_inst_map &) = delete;
+    nb_inst_map &operator=(const nb_inst_map &) = delete;
+
+    ~nb_inst_map() {
+        while (t) {
+            table *next = t->retired;
+            PyMem_RawFree(t);
+            t = next;
+        }
+    }
+
+    size_t size() const { return count; }
+
+    iterator begin() const {
+        return t ? iterator(t->slots(), t->slots() + t->mask + 1) : end();
+    }
+
+    iterator end() const {
+        slot *e = t ? t->slots() + t->mask + 1 : nullptr;
+        return iterator(e, e);
+    }
+
+    iterator find(void *key) const {
+        if (!t)
+            return end();
+        slot *s = t->slots();
+        for (size_t i = home(key, t->mask);; i = (i + 1) & t->mask) {
+            void *k = s[i].first;
+            if (k == key)
+                return iterator(s + i, s + t->mask + 1);
+            else if (!k)
+                return end();
+        }
+    }
+
+    std::pair<iterator, bool> try_emplace(void *key, void *value) {
+        if (NB_UNLIKELY(!t || (count + 1) * 4 > (t->mask + 1) * 3))
+            grow();
+
+        slot *s = t->slots();
+        for (size_t i = home(key, t->mask);; i = (i + 1) & t->mask) {
+            void *k = s[i].first;
+            if (k == key)
+                return { iterator(s + i, s + t->mask + 1), false };
+
+            if (!k) {
+                // Readers stop at empty slots and cannot observe the value
+                // before the key
+                cell(s[i].second).store(value, std::memory_order_relaxed);
+                cell(s[i].first).store(key, std::memory_order_release);
+                count++;
+                return { iterator(s + i, s + t->mask + 1), true };
+            }
+        }
+    }
+
+    void erase_fast(iterator it) {
+        slot *s = t->slots();
+        size_t mask = t->mask,
+               hole = (size_t) (it.s - s);
+
+        cell(s[hole].first).store(busy(), std::memory_order_relaxed);
+
+        for (size_t j = (hole + 1) & mask;; j = (j + 1) & mask) {
+            void *k = s[j].first;
+            if (!k)
+                break;
+
+            // Move the entry into the hole unless that would place it before
+            // its initial probe position
+            if (((j - home(k, mask)) & mask) >= ((j - hole) & mask)) {
+                std::atomic_thread_fence(std::memory_order_release);
+                cell(s[hole].second).store(s[j].second, std::memory_order_relaxed);
+                cell(s[hole].first).store(k, std::memory_order_release);
+                cell(s[j].first).store(busy(), std::memory_order_relaxed);
+                hole = j;
+            }
+        }
+
+        cell(s[hole].first).store(nullptr, std::memory_order_release);
+        count--;
+    }
+
+    /// Return the value associated with 'key' without locking. A null result
+    /// either means that the key is absent, or that a concurrent
+    /// modification got in the way.
+    void *lookup(void *key) const noexcept {
+        table *tb = cell(const_cast<table *&>(t)).load(std::memory_order_acquire);
+        if (!tb)
+            return nullptr;
+
+        slot *s = tb->slots();
+        size_t mask = tb->mask;
+
+        for (size_t i = home(key, mask), n = 0; n <= mask;
+             i = (i + 1) & mask, ++n) {
+            void *k = cell(s[i].first).load(std::memory_order_acquire);
+
+            if (k == key) {
+                void *value = cell(s[i].second).load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (cell(s[i].first).load(std::memory_order_relaxed) != key)
+                    return nullptr;
+                return value;
+            } else if (!k) {
+                return nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    /// Header of a slot array. The slots follow the header contiguously.
+    struct table {
+        table *retired; ///< Chain of previous slot arrays
+        size_t mask;    ///< Capacity (a power of two) minus one
+
+        slot *slots() const { return (slot *) (this + 1); }
+    };
+
+    /// Key of a slot that is being modified
+    static void *busy() { return (void *) (uintptr_t) 1; }
+    static bool used(void *key) { return (uintptr_t) key > 1; }
+
+    static size_t home(void *key, size_t mask) {
+        return ptr_hash()(key) & mask;
+    }
+
+    template <typename T> static std::atomic<T> &cell(T &value) {
+        return *(std::atomic<T> *) &value;
+    }
+
+    NB_NOINLINE void grow() {
+        size_t size = t ? (t->mask + 1) * 2 : 16;
+        table *tn = (table *) PyMem_RawCalloc(1, sizeof(table) + size * sizeof(slot));
+        check(tn, "nanobind::detail::nb_inst_map::grow(): allocation failed!");
+        tn->mask = size - 1;
+        tn->retired = t;
+
+        // The new array is not visible to readers yet
+        if (t) {
+            slot *s = tn->slots();
+            for (slot &e : *this) {
+                size_t i = home(e.first, tn->mask);
+                while (s[i].first)
+                    i = (i + 1) & tn->mask;
+                s[i] = e;
+            }
+        }
+
+        cell(t).store(tn, std::memory_order_release);
+    }
+
+    table *t = nullptr;
+    size_t count = 0;
+};
+#else
+using nb_inst_map = nb_ptr_map;
+#endif
+
 struct nb_translator_seq {
     exception_translator translator;
     void *payload;
@@ -604,41 +995,25 @@ struct NB_SHARD_ALIGNMENT nb_shard {
      * The latter case occurs when several distinct Python objects reference
      * the same memory address (e.g. a struct and its first member).
      */
-    nb_ptr_map inst_c2p;
+    nb_inst_map inst_c2p;
 
     /// Dictionary storing keep_alive references
     nb_ptr_map keep_alive;
 
 #if defined(NB_FREE_THREADED)
     PyMutex mutex { };
-#endif
-};
 
+    /// Copy of 'nb_internals::shard_stats' next to the mutex
+    std::atomic<bool> stats { false };
 
-/**
- * Wraps a std::atomic if free-threading is enabled, otherwise a raw value.
- */
-#if defined(NB_FREE_THREADED)
-template<typename T>
-struct nb_maybe_atomic {
-  nb_maybe_atomic(T v = T()) : value(v) {}
-
-  std::atomic<T> value;
-  T load_acquire() { return value.load(std::memory_order_acquire); }
-  T load_relaxed() { return value.load(std::memory_order_relaxed); }
-  void store_release(T w) { value.store(w, std::memory_order_release); }
-};
-#else
-template<typename T>
-struct nb_maybe_atomic {
-  nb_maybe_atomic(T v = T()) : value(v) {}
+    /// Number of threads that hold or wait for 'mutex' (when counting)
+    std::atomic<uint32_t> lock_users { 0 };
 
-  T value;
-  T load_acquire() { return value; }
-  T load_relaxed() { return value; }
-  void store_release(T w) { value = w; }
-};
+    /// Lock acquisitions, and the subset that had to wait (see nb::shard_stats())
+    uint64_t lock_count = 0;
+    uint64_t lock_contended = 0;
 #endif
+};
 
 /// Cache slots for `nb_internals::ndarray_export`: cached callables that build a
 /// framework's array from nanobind's DLPack/buffer wrapper.
@@ -726,7 +1101,8 @@ struct pyobj_name {
  * - `nb_static_property` and `nb_static_propert_descr_set`: created only once
  *   on demand, protected by `mutex`.
  *
- * - `nb_ndarray`: created only once on demand, protected by `mutex`.
+ * - `nb_ndarray`, `nb_member`: created only once on demand, protected by
+ *   `mutex`.
  *
  * - `inst_c2p`: stores the C++ instance to Python object mapping. This
  *   data struture is *hot* and uses a sharded locking scheme to reduce
@@ -746,6 +1122,9 @@ struct pyobj_name {
  *   `std::type_info` to `type_info *` but uses pointer-based comparisons.
  *   The implementation depends on the Python build.
  *
+ * - `ndarray_types`, `ndarray_exports`: caches used by the ndarray caster.
+ *   Free-threaded builds store them per thread in 'nb_thread_state'.
+ *
  * - `translators`: This is an append-to-front-only singly linked list traversed
  *    while raising exceptions. The main concern is losing elements during
  *    concurrent append operations. We assume that this data structure is only
@@ -754,8 +1133,10 @@ struct pyobj_name {
  * - `funcs`: data structure for function leak tracking. Not used in
  *   free-threaded mode .
  *
- * - `print_leak_warnings`, `print_implicit_cast_warnings`: simple boolean
- *   flags. No protection against concurrent conflicting updates.
+ * - `print_leak_warnings`, `print_implicit_cast_warnings`,
+ *   `ndarray_copy_threads`, `ndarray_copy_threshold`,
+ *   `ndarray_export_cache`, `shard_stats`: simple configuration
+ *   values. No protection against concurrent conflicting updates.
  */
 struct nb_internals {
     /// Internal nanobind module
@@ -771,6 +1152,9 @@ struct nb_internals {
     nb_maybe_atomic<PyTypeObject *> nb_static_property = nullptr;
     descrsetfunc nb_static_property_descr_set = nullptr;
 
+    /// Property variant for direct field access (created on demand)
+    nb_maybe_atomic<PyTypeObject *> nb_member = nullptr;
+
     /// N-dimensional array wrapper (created on demand)
     nb_maybe_atomic<PyTypeObject *> nb_ndarray = nullptr;
 
@@ -778,6 +1162,13 @@ struct nb_internals {
     /// `ndarray_export_slot`.
     nb_maybe_atomic<PyObject *> ndarray_export[nd_export_count] {};
 
+#if !defined(NB_FREE_THREADED)
+    /// Recycled ndarray handles and storage (per thread in free-threaded
+    /// builds)
+    nb_ndarray_pool ndarray_pool { };
+    nb_ndarray_alloc_pool ndarray_alloc_pool { };
+#endif
+
 #if defined(NB_FREE_THREADED)
     nb_shard *shards = nullptr;
     size_t shard_mask = 0;
@@ -810,11 +1201,25 @@ struct nb_internals {
 #if !defined(NB_FREE_THREADED)
     /// C++ -> Python type map -- fast version based on std::type_info pointer equality
     nb_type_map_fast type_c2p_fast;
+
+    /// Properties of types passed to ndarray_import()
+    nb_ndarray_type_map ndarray_types;
+
+    /// Objects created by recent ndarray exports
+    nb_ndarray_export_map ndarray_exports;
+
+    /// Number of completed observation windows of the instance pools
+    uint32_t pool_windows = 0;
 #endif
 
     /// C++ -> Python type map -- slow fallback version based on hashed strings
     nb_type_map_slow type_c2p_slow;
 
+    /// Identifies the contents of 'type_c2p_slow' to validate the frontend
+    /// type caches (see nb_type_c2p_cached()). Takes a fresh nonzero value,
+    /// unique across domains, whenever a type is registered or removed.
+    nb_maybe_atomic<uint32_t> type_epoch = 0;
+
 #if !defined(NB_FREE_THREADED)
     /// nb_func/meth instance map for leak reporting (used as set, the value is unused)
     /// In free-threaded mode, functions are immortal and don't require this data structure.
@@ -836,6 +1241,17 @@ struct nb_internals {
     /// Should nanobind print warnings after implicit cast failures?
     bool print_implicit_cast_warnings = true;
 
+    /// Number of threads copying large arrays during ndarray conversions
+    /// (0: automatic), and the size in bytes from which they are used
+    uint32_t ndarray_copy_threads = 0;
+    uint32_t ndarray_copy_threshold = 16u << 20;
+
+    /// Should ndarray_export() reuse the objects of previous exports?
+    bool ndarray_export_cache = false;
+
+    /// Should the shard locks be counted (see nb::shard_stats())?
+    bool shard_stats = false;
+
     /// Pointer to a boolean that denotes if nanobind is fully initialized.
     bool *is_alive_ptr = nullptr;
 
@@ -991,8 +1407,14 @@ extern PyObject *type_lookup(nb_internals *p, PyObject *t,
 
 extern type_data *nb_type_c2p(nb_internals *internals,
                               const std::type_info *type);
+extern type_data *nb_type_c2p_cached(nb_internals *internals,
+                                     const std::type_info *type,
+                                     type_cache *c);
 extern void nb_type_unregister(type_data *t) noexcept;
 
+/// Invalidate the frontend type caches after changing 'type_c2p_slow'
+extern void nb_type_epoch_bump(nb_internals *p) noexcept;
+
 /// Drop the published trampoline tables of 'tp' and its subclasses after a
 /// type modification so that overrides are re-resolved (GIL held)
 extern void nb_trampoline_invalidate(PyObject *tp) noexcept;
@@ -1060,6 +1482,8 @@ NB_INLINE type_data *nb_type_data(PyTypeObject *o) noexcept{
 }
 
 inline void *inst_ptr(nb_inst *self) {
+    if (self->state.compact)
+        return (void *) &self->offset;
     void *ptr = (void *) ((intptr_t) self + self->offset);
     return self->state.direct ? ptr : *(void **) ptr;
 }
@@ -1085,6 +1509,33 @@ extern nb_inst_pool *nb_pool_ensure(type_data *td) noexcept;
 /// Release all objects kept in the given instance pool
 extern void nb_pool_drain(nb_inst_pool *pool, bool can_free) noexcept;
 
+/// Release all blocks kept in the given ndarray handle pool
+extern void nb_ndarray_pool_drain(nb_ndarray_pool *pool) noexcept;
+
+/// Release all blocks kept in the given ndarray storage pool
+extern void nb_ndarray_alloc_pool_drain(nb_ndarray_alloc_pool *pool) noexcept;
+
+/// Release the weak references kept in the given ndarray export cache
+extern void nb_ndarray_exports_clear(nb_ndarray_export_map &exports) noexcept;
+
+/// Publish the counters of a pool and adapt its capacity (see nb_pool_tick())
+extern void nb_pool_adapt(type_data *td, nb_inst_pool *pool) noexcept;
+
+/// Record 'n' allocations or releases involving a pool. Its capacity is
+/// revisited after a window of events proportional to the capacity.
+NB_INLINE void nb_pool_tick(type_data *td, nb_inst_pool *pool,
+                            uint32_t n = 1) noexcept {
+    if (pool->count < pool->low_water)
+        pool->low_water = pool->count;
+    pool->events += n;
+
+    uint32_t window = pool->capacity * 4;
+    if (window < 256)
+        window = 256;
+    if (NB_UNLIKELY(pool->events >= window))
+        nb_pool_adapt(td, pool);
+}
+
 template <typename T> struct scoped_pymalloc {
     scoped_pymalloc(size_t size = 1, size_t extra_bytes = 0) {
         size_t total = size * sizeof(T);
@@ -1113,10 +1564,34 @@ private:
 
 /// RAII lock/unlock guards for free-threaded builds
 #if defined(NB_FREE_THREADED)
+/// Lock a shard and update its counters (see nb_shard_lock())
+extern void nb_shard_lock_counted(nb_shard &s) noexcept;
+
+/// Lock a shard. When statistics are enabled (nb::set_shard_stats_enabled()),
+/// the acquisition is counted. PyMutex has no public try-lock operation, so
+/// it counts as contended if another thread held or waited for the lock when
+/// this thread announced itself in 'lock_users'. Returns whether the caller
+/// must pass 'counted' to nb_shard_unlock().
+inline bool nb_shard_lock(nb_shard &s) noexcept {
+    if (NB_LIKELY(!s.stats.load(std::memory_order_relaxed))) {
+        PyMutex_Lock(&s.mutex);
+        return false;
+    }
+    nb_shard_lock_counted(s);
+    return true;
+}
+
+inline void nb_shard_unlock(nb_shard &s, bool counted) noexcept {
+    PyMutex_Unlock(&s.mutex);
+    if (NB_UNLIKELY(counted))
+        s.lock_users.fetch_sub(1, std::memory_order_relaxed);
+}
+
 struct lock_shard {
     nb_shard &s;
-    lock_shard(nb_shard &s) : s(s) { PyMutex_Lock(&s.mutex); }
-    ~lock_shard() { PyMutex_Unlock(&s.mutex); }
+    bool counted;
+    lock_shard(nb_shard &s) : s(s) { counted = nb_shard_lock(s); }
+    ~lock_shard() { nb_shard_unlock(s, counted); }
 };
 struct lock_internals {
     nb_internals *i;
@@ -0,0 +1,361 @@
+/*
+    src/nb_member.cpp: descriptor providing direct access to scalar fields
+
+    Copyright (c) 2022 Wenzel Jakob
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE file.
+*/
+
+#include "nb_internals.h"
+
+NAMESPACE_BEGIN(NB_NAMESPACE)
+NAMESPACE_BEGIN(detail)
+
+/* def_rw() and def_ro() normally create a property, whose getter and setter
+   are nanobind functions. Reading or writing a field then involves the
+   function dispatcher and a type caster.
+
+   The 'nb_member' type derives from 'property' and short-circuits this for
+   fields holding an arithmetic, bool, or enumeration value. Its __get__() and
+   __set__() methods access the field at a fixed offset from the instance
+   data. The frontend cannot compute this offset from a member pointer without
+   an object to apply it to, so the descriptor asks the frontend to do so when
+   it accesses the first instance and caches the result.
+
+   The __get__() and __set__() methods delegate to the bound getter/setter
+   when the fast path does not apply (e.g., uninitialized instances,
+   incompatible values), so error handling and messages are unchanged. Being
+   a 'property', the descriptor also looks the same to introspection and stub
+   generation. */
+
+struct nb_member_data {
+    /// Backend state (needed to convert enumerations)
+    nb_internals *internals;
+
+    /// Type declaring the field (borrowed, the type owns the descriptor)
+    PyTypeObject *owner;
+
+    /// C++ type of enumeration fields
+    const std::type_info *type;
+
+    /// Byte offset of the field within the instance data (or NB_MEMBER_UNKNOWN)
+    nb_maybe_atomic<size_t> offset;
+
+    /// Computes 'offset' from an instance and the member pointer below
+    size_t (*offset_fn)(const void *, const void *);
+
+    /// Bytes of the C++ member pointer designating the field
+    uint8_t member[16];
+
+    /// Description of the field (see 'member_flags')
+    uint32_t flags;
+
+    /// Does the property have a setter?
+    bool writable;
+};
+
+/// Marks a field offset that has not been computed yet
+#define NB_MEMBER_UNKNOWN ((size_t) -1)
+
+static nb_member_data *nb_member_data_get(PyObject *self) noexcept {
+#if PY_VERSION_HEX >= 0x030C0000
+    return (nb_member_data *) PyObject_GetTypeData(self, Py_TYPE(self));
+#else
+    return (nb_member_data *) ((uint8_t *) self +
+                               PyProperty_Type.tp_basicsize);
+#endif
+}
+
+/// Return the address of the field within 'obj', or nullptr if the fast path
+/// does not apply
+static void *nb_member_field(nb_member_data *d, PyObject *obj) noexcept {
+    PyTypeObject *tp = Py_TYPE(obj);
+    if (NB_UNLIKELY(tp != d->owner && !PyType_IsSubtype(tp, d->owner)))
+        return nullptr;
+
+    nb_inst *inst = (nb_inst *) obj;
+    if (NB_UNLIKELY(inst->state.state != nb_inst_state::state_ready))
+        return nullptr;
+
+    void *ptr = inst_ptr(inst);
+
+    // The offset is the same for every instance. Concurrent threads that
+    // compute it at the same time store identical values.
+    size_t offset = d->offset.load_relaxed();
+    if (NB_UNLIKELY(offset == NB_MEMBER_UNKNOWN)) {
+        offset = d->offset_fn(ptr, d->member);
+        d->offset.store_relaxed(offset);
+    }
+
+    return (uint8_t *) ptr + offset;
+}
+
+/// Read an integer field of the given size, extending it to 64 bits
+static int64_t nb_member_read_int(const void *field, uint32_t flags) noexcept {
+    bool is_signed = flags & (uint32_t) member_flags::is_signed;
+
+    switch (flags & 0xFF) {
+        case 1: return is_signed ? (int64_t) *(const int8_t *) field
+                                 : (int64_t) *(const uint8_t *) field;
+        case 2: return is_signed ? (int64_t) *(const int16_t *) field
+                                 : (int64_t) *(const uint16_t *) field;
+        case 4: return is_signed ? (int64_t) *(const int32_t *) field
+                                 : (int64_t) *(const uint32_t *) field;
+        default: return *(const int64_t *) field;
+    }
+}
+
+/// Write an integer field of the given size, truncating the value
+static void nb_member_write_int(void *field, uint32_t flags,
+                                int64_t value) noexcept {
+    switch (flags & 0xFF) {
+        case 1: *(uint8_t *) field = (uint8_t) value; break;
+        case 2: *(uint16_t *) field = (uint16_t) value; break;
+        case 4: *(uint32_t *) field = (uint32_t) value; break;
+        default: *(int64_t *) field = value; break;
+    }
+}
+
+static PyObject *nb_member_load(const nb_member_data *d,
+                                const void *field) noexcept {
+    uint32_t flags = d->flags;
+
+    if (flags & (uint32_t) member_flags::is_bool)
+        return Py_NewRef(*(const bool *) field ? Py_True : Py_False);
+
+    if (flags & (uint32_t) member_flags::is_float)
+        return PyFloat_FromDouble((flags & 0xFF) == 4
+                                      ? (double) *(const float *) field
+                                      : *(const double *) field);
+
+    int64_t value = nb_member_read_int(field, flags);
+
+    if (flags & (uint32_t) member_flags::is_enum)
+        return enum_from_cpp(d->internals, d->type, value);
+    else if (flags & (uint32_t) member_flags::is_signed)
+        return PyLong_FromLongLong((long long) value);
+    else
+        return PyLong_FromUnsignedLongLong((unsigned long long) value);
+}
+
+static bool nb_member_store(const nb_member_data *d, void *field,
+                            PyObject *value) noexcept {
+    nb_internals *p = d->internals;
+    uint32_t flags = d->flags,
+             cflags = (uint32_t) cast_flags::convert;
+    bool is_signed = flags & (uint32_t) member_flags::is_signed;
+
+    if (flags & (uint32_t) member_flags::is_bool) {
+        if (value != Py_True && value != Py_False)
+            return false;
+        *(bool *) field = value == Py_True;
+        return true;
+    }
+
+    if (flags & (uint32_t) member_flags::is_float) {
+        if ((flags & 0xFF) == 4) {
+            float f;
+            if (!load_f32(p, value, cflags, &f))
+                return false;
+            *(float *) field = f;
+        } else {
+            double f;
+            if (!load_f64(p, value, cflags, &f))
+                return false;
+            *(double *) field = f;
+        }
+        return true;
+    }
+
+    if (flags & (uint32_t) member_flags::is_enum) {
+        int64_t i;
+        if (!enum_from_python(p, d->type, value, &i, cflags))
+            return false;
+        nb_member_write_int(field, flags, i);
+        return true;
+    }
+
+    bool success;
+    switch (flags & 0xFF) {
+        case 1:
+            if (is_signed) {
+                int8_t i;
+                if ((success = load_i8(p, value, cflags, &i)))
+                    *(int8_t *) field = i;
+            } else {
+                uint8_t i;
+                if ((success = load_u8(p, value, cflags, &i)))
+                    *(uint8_t *) field = i;
+            }
+            break;
+
+        case 2:
+            if (is_signed) {
+                int16_t i;
+                if ((success = load_i16(p, value, cflags, &i)))
+                    *(int16_t *) field = i;
+            } else {
+                uint16_t i;
+                if ((success = load_u16(p, value, cflags, &i)))
+                    *(uint16_t *) field = i;
+            }
+            break;
+
+        case 4:
+            if (is_signed) {
+                int32_t i;
+                if ((success = load_i32(p, value, cflags, &i)))
+                    *(int32_t *) field = i;
+            } else {
+                uint32_t i;
+                if ((success = load_u32(p, value, cflags, &i)))
+                    *(uint32_t *) field = i;
+            }
+            break;
+
+        default:
+            if (is_signed) {
+                int64_t i;
+                if ((success = load_i64(p, value, cflags, &i)))
+                    *(int64_t *) field = i;
+            } else {
+                uint64_t i;
+                if ((success = load_u64(p, value, cflags, &i)))
+                    *(uint64_t *) field = i;
+            }
+            break;
+    }
+
+    return success;
+}
+
+/// `nb_member.__get__()`
+static PyObject *nb_member_descr_get(PyObject *self, PyObject *obj,
+                                     PyObject *cls) {
+    if (obj) {
+        nb_member_data *d = nb_member_data_get(self);
+        void *field = nb_member_field(d, obj);
+
+        if (NB_LIKELY(field)) {
+            PyObject *result = nb_member_load(d, field);
+            if (NB_LIKELY(result))
+                return result;
+            PyErr_Clear(); // let the getter report the error
+        }
+    }
+
+    return NB_TYPE_SLOT(PyProperty_Type, tp_descr_get)(self, obj, cls);
+}
+
+/// `nb_member.__set__()`
+static int nb_member_descr_set(PyObject *self, PyObject *obj,
+                               PyObject *value) {
+    nb_member_data *d = nb_member_data_get(self);
+
+    if (value && d->writable) {
+        void *field = nb_member_field(d, obj);
+        if (NB_LIKELY(field) && NB_LIKELY(nb_member_store(d, field, value)))
+            return 0;
+    }
+
+    return NB_TYPE_SLOT(PyProperty_Type, tp_descr_set)(self, obj, value);
+}
+
+static PyTypeObject *nb_member_tp(nb_internals *p) noexcept {
+    PyTypeObject *tp = p->nb_member.load_acquire();
+
+    if (NB_UNLIKELY(!tp)) {
+        lock_internals guard(p);
+
+        tp = p->nb_member.load_relaxed();
+        if (tp)
+            return tp;
+
+        PyMemberDef *members =
+            (PyMemberDef *) PyType_GetSlot(&PyProperty_Type, Py_tp_members);
+
+        PyType_Slot slots[] = {
+            { Py_tp_base, &PyProperty_Type },
+            { Py_tp_descr_get, (void *) nb_member_descr_get },
+            { Py_tp_descr_set, (void *) nb_member_descr_set },
+            { Py_tp_members, members },
+            { 0, nullptr }
+        };
+
+#if PY_VERSION_HEX >= 0x030C0000
+        int basicsize = -(int) sizeof(nb_member_data);
+#else
+        int basicsize = (int) PyProperty_Type.tp_basicsize +
+                        (int) sizeof(nb_member_data);
+#endif
+
+        PyType_Spec spec = {
+            /* .name = */ "nanobind.nb_member",
+            /* .basicsize = */ basicsize,
+            /* .itemsize = */ 0,
+            /* .flags = */ Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE,
+            /* .slots = */ slots
+        };
+
+        tp = new_type(p, &spec);
+        check(tp, "nb_member type creation failed!");
+
+        p->nb_member.store_release(tp);
+    }
+
+    return tp;
+}
+
+static void member_install_impl(nb_internals *p, PyObject *scope,
+                                const char *name, PyObject *getter,
+                                PyObject *setter, const void *member,
+                                size_t member_size,
+                                size_t (*offset)(const void *, const void *),
+                                uint32_t flags, const std::type_info *type) {
+    check(member_size <= sizeof(nb_member_data::member),
+          "nanobind::detail::member_install(\"%s\"): member pointer is too "
+          "large!", name);
+
+    object doc = none();
+
+    PyTypeObject *gt = Py_TYPE(getter);
+    if (gt == p->nb_func || gt == p->nb_method) {
+        func_data *f = nb_func_data(getter);
+        if (f->flags & (uint32_t) func_flags::has_doc)
+            doc = str(f->doc);
+    }
+
+    object prop = obj_call(p, handle((PyObject *) nb_member_tp(p)),
+                           handle(getter),
+                           handle(setter ? setter : none_ptr()),
+                           handle(none_ptr()) /* deleter */, doc);
+
+    nb_member_data *d = nb_member_data_get(prop.ptr());
+    d->internals = p;
+    d->owner = (PyTypeObject *) scope;
+    d->type = type;
+    d->offset.store_relaxed(NB_MEMBER_UNKNOWN);
+    d->offset_fn = offset;
+    memcpy(d->member, member, member_size);
+    d->flags = flags;
+    d->writable = setter != nullptr;
+
+    str_setattr(p, scope, name, prop);
+}
+
+void member_install(nb_internals *p, PyObject *scope, const char *name,
+                    PyObject *getter, PyObject *setter, const void *member,
+                    size_t member_size,
+                    size_t (*offset)(const void *, const void *),
+                    uint32_t flags, const std::type_info *type) noexcept {
+    try {
+        member_install_impl(p, scope, name, getter, setter, member,
+                            member_size, offset, flags, type);
+    } catch (...) {
+        fail_exception("nanobind::detail::member_install", name);
+    }
+}
+
+NAMESPACE_END(detail)
+NAMESPACE_END(NB_NAMESPACE)
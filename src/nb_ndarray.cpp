@@ -1,8 +1,24 @@
 #include <nanobind/ndarray.h>
 #include <atomic>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <thread>
 #include "nb_internals.h"
 
+#if defined(_WIN32)
+#  if !defined(NOMINMAX)
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#  include <io.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 NAMESPACE_BEGIN(NB_NAMESPACE)
 
 NAMESPACE_BEGIN(dlpack)
@@ -89,10 +105,13 @@ struct ndarray_handle {
     };
     std::atomic<size_t> refcount;
     PyObject *owner, *self;
+    nb_internals *internals; // Backend state, whose pool recycles the handle.
     bool versioned;     // This tags which union member is active.
     bool free_strides;  // True if we added strides to an imported tensor.
-    bool call_deleter;  // True if tensor was imported, else PyMem_Free(mt).
+    bool call_deleter;  // True if tensor was imported, else mt is ours.
     bool ro;            // Whether tensor is read-only.
+    uint8_t framework;  // Source framework of a converted copy, else 0.
+    uint8_t size_class; // Free list of the handle (see ndarray_block).
 
     dlpack::dltensor &tensor() {
         return versioned ? mt_versioned->dltensor : mt_unversioned->dltensor;
@@ -136,6 +155,95 @@ struct ndarray_handle {
     }
 };
 
+/* Handles are allocated together with a managed tensor (used by
+   ndarray_create()) and room for 'ndim' shape and stride entries. Blocks for
+   arrays with up to 4 or 8 dimensions have a fixed size, and freed ones are
+   kept in per-thread free lists ('nb_ndarray_pool') for reuse. Functions that
+   exchange small arrays at a high rate then don't need the allocator. Blocks
+   come from the raw allocator, which does not require a thread state, so that
+   the free lists can still be released when the interpreter has shut down. */
+struct ndarray_block {
+    ndarray_handle handle;
+    managed_dltensor_versioned mt;
+    // int64_t shape[cap], strides[cap];
+};
+
+/// Maximum number of blocks in each free list
+static constexpr uint32_t ndarray_pool_limit = 64;
+
+static nb_ndarray_pool &ndarray_pool(nb_internals *p) noexcept {
+#if defined(NB_FREE_THREADED)
+    return nb_thread_state_get(p)->ndarray_pool;
+#else
+    return p->ndarray_pool;
+#endif
+}
+
+static ndarray_handle *ndarray_handle_alloc(nb_internals *p, int32_t ndim) {
+    uint8_t size_class = ndim <= 4 ? 0 : ndim <= 8 ? 1 : 2;
+    ndarray_handle *th = nullptr;
+
+    if (size_class < 2) {
+        nb_ndarray_pool &pool = ndarray_pool(p);
+        void *block = pool.head[size_class];
+        if (block) {
+            pool.head[size_class] = *(void **) block;
+            pool.count[size_class]--;
+            th = (ndarray_handle *) block;
+        }
+    }
+
+    if (!th) {
+        size_t cap = size_class == 0 ? 4 : size_class == 1 ? 8 : (size_t) ndim;
+        size_t size = sizeof(ndarray_block) + 2 * sizeof(int64_t) * cap;
+        ndarray_block *block = (ndarray_block *) PyMem_RawMalloc(size);
+        if (!block)
+            fail("ndarray_handle_alloc(): could not allocate %llu bytes of "
+                 "memory!", (unsigned long long) size);
+        th = &block->handle;
+    }
+
+    th->internals = p;
+    th->size_class = size_class;
+    return th;
+}
+
+/// Managed tensor and shape/stride storage of a handle block
+static managed_dltensor_versioned *ndarray_block_mt(ndarray_handle *th) {
+    return &((ndarray_block *) th)->mt;
+}
+
+static int64_t *ndarray_block_dims(ndarray_handle *th) {
+    return (int64_t *) ((ndarray_block *) th + 1);
+}
+
+static void ndarray_handle_free(ndarray_handle *th) noexcept {
+    uint8_t size_class = th->size_class;
+    if (size_class < 2) {
+        nb_ndarray_pool &pool = ndarray_pool(th->internals);
+        if (pool.count[size_class] < ndarray_pool_limit) {
+            *(void **) th = pool.head[size_class];
+            pool.head[size_class] = th;
+            pool.count[size_class]++;
+            return;
+        }
+    }
+    PyMem_RawFree(th);
+}
+
+void nb_ndarray_pool_drain(nb_ndarray_pool *pool) noexcept {
+    for (int i = 0; i < 2; ++i) {
+        void *block = pool->head[i];
+        while (block) {
+            void *next = *(void **) block;
+            PyMem_RawFree(block);
+            block = next;
+        }
+        pool->head[i] = nullptr;
+        pool->count[i] = 0;
+    }
+}
+
 // ========================================================================
 
 static void nb_ndarray_dealloc(PyObject *self) {
@@ -448,18 +556,9 @@ static PyTypeObject *nb_ndarray_tp(nb_internals *internals_) noexcept {
 
 // ========================================================================
 
-using mt_unique_ptr_t = std::unique_ptr<managed_dltensor_versioned,
-                                        decltype(&mt_from_buffer_delete)>;
-
-static mt_unique_ptr_t make_mt_from_buffer_protocol(PyObject *o, bool ro) {
-    mt_unique_ptr_t mt_unique_ptr(nullptr, &mt_from_buffer_delete);
-    scoped_pymalloc<Py_buffer> view;
-    if (PyObject_GetBuffer(o, view.get(),
-                           ro ? PyBUF_RECORDS_RO : PyBUF_RECORDS)) {
-        PyErr_Clear();
-        return mt_unique_ptr;
-    }
-
+/// Determine the DLPack data type of the elements of a buffer from its struct
+/// module-style format string. Returns false if this is not possible.
+static bool buffer_dtype(const Py_buffer *view, dlpack::dtype &dt) noexcept {
     char format_c = 'B';
     const char *format_str = view->format;
     if (format_str)
@@ -483,45 +582,60 @@ static mt_unique_ptr_t make_mt_from_buffer_protocol(PyObject *o, bool ro) {
     if (is_complex)
         format_c = *++format_str;
 
-    dlpack::dtype dt { };
-    bool fail = format_str && format_str[0] != '\0' && format_str[1] != '\0';
-
-    if (!fail) {
-        switch (format_c) {
-            case 'c':
-            case 'b':
-            case 'h':
-            case 'i':
-            case 'l':
-            case 'q':
-            case 'n': dt.code = (uint8_t) dlpack::dtype_code::Int; break;
-
-            case 'B':
-            case 'H':
-            case 'I':
-            case 'L':
-            case 'Q':
-            case 'N': dt.code = (uint8_t) dlpack::dtype_code::UInt; break;
-
-            case 'e':
-            case 'f':
-            case 'd': dt.code = (uint8_t) dlpack::dtype_code::Float; break;
-
-            case '?': dt.code = (uint8_t) dlpack::dtype_code::Bool; break;
-
-            default: fail = true;
-        }
+    dt = dlpack::dtype{};
+    if (format_str && format_str[0] != '\0' && format_str[1] != '\0')
+        return false;
+
+    switch (format_c) {
+        case 'c':
+        case 'b':
+        case 'h':
+        case 'i':
+        case 'l':
+        case 'q':
+        case 'n': dt.code = (uint8_t) dlpack::dtype_code::Int; break;
+
+        case 'B':
+        case 'H':
+        case 'I':
+        case 'L':
+        case 'Q':
+        case 'N': dt.code = (uint8_t) dlpack::dtype_code::UInt; break;
+
+        case 'e':
+        case 'f':
+        case 'd': dt.code = (uint8_t) dlpack::dtype_code::Float; break;
+
+        case '?': dt.code = (uint8_t) dlpack::dtype_code::Bool; break;
+
+        default: return false;
+    }
 
-        if (is_complex) {
-            fail |= dt.code != (uint8_t) dlpack::dtype_code::Float;
-            dt.code = (uint8_t) dlpack::dtype_code::Complex;
-        }
+    if (is_complex) {
+        if (dt.code != (uint8_t) dlpack::dtype_code::Float)
+            return false;
+        dt.code = (uint8_t) dlpack::dtype_code::Complex;
+    }
+
+    dt.lanes = 1;
+    dt.bits = (uint8_t) (view->itemsize * 8);
+    return true;
+}
+
+using mt_unique_ptr_t = std::unique_ptr<managed_dltensor_versioned,
+                                        decltype(&mt_from_buffer_delete)>;
 
-        dt.lanes = 1;
-        dt.bits = (uint8_t) (view->itemsize * 8);
+static mt_unique_ptr_t make_mt_from_buffer_protocol(PyObject *o, bool ro) {
+    mt_unique_ptr_t mt_unique_ptr(nullptr, &mt_from_buffer_delete);
+    scoped_pymalloc<Py_buffer> view;
+    if (PyObject_GetBuffer(o, view.get(),
+                           ro ? PyBUF_RECORDS_RO : PyBUF_RECORDS)) {
+        PyErr_Clear();
+        return mt_unique_ptr;
     }
 
-    if (fail) {
+    dlpack::dtype dt;
+    if (!buffer_dtype(view.get(), dt)) {
         PyBuffer_Release(view.get());
         return mt_unique_ptr;
     }
@@ -689,14 +803,8 @@ static object dlpack_method(nb_internals *p, PyTypeObject *tp) noexcept {
 #endif
 }
 
-bool ndarray_check(nb_internals *p, PyObject *o) noexcept {
-    PyTypeObject *tp = Py_TYPE(o);
-    if (dlpack_method(p, tp).is_valid() || obj_has_buffer(o, tp))
-        return true;
-
-    if (tp == &PyCapsule_Type)
-        return true;
-
+// Does `tp` have the name of a known array type? Used by ndarray_check().
+static bool is_array_type(PyTypeObject *tp) noexcept {
     PyObject *name = nb_type_name((PyObject *) tp);
     check(name, "Could not obtain type name! (1)");
 
@@ -715,133 +823,496 @@ bool ndarray_check(nb_internals *p, PyObject *o) noexcept {
     return result;
 }
 
-// Helper function reports whether `code` represents a complex number.
-static NB_INLINE bool dtype_code_is_complex(uint8_t code) {
-    return code == (uint8_t) dlpack::dtype_code::Complex ||
-           code == (uint8_t) dlpack::dtype_code::Bcomplex;
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
+// Version tag of `tp`, or 0 if it has none. CPython assigns a new tag when a
+// type is modified, and a newly created type never reuses an old tag.
+static uint32_t type_version(PyTypeObject *tp) noexcept {
+#if PY_VERSION_HEX < 0x030C0000
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return 0;
+#endif
+    return tp->tp_version_tag;
 }
 
-static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
-                                           const ndarray_config &cfg,
-                                           bool convert,
-                                           cleanup_list *cleanup) noexcept {
-    object capsule;
-    mt_unique_ptr_t mt_unique_ptr(nullptr, &mt_from_buffer_delete);
+// Return the properties of `tp`, consulting a cache keyed by the type and its
+// version tag. Repeated imports from the same type (the common case) then
+// avoid the '__dlpack__' lookup, the '__module__' string comparisons, and the
+// type name construction in ndarray_check().
+static nb_ndarray_type_info ndarray_type_info(nb_internals *p,
+                                              PyTypeObject *tp) noexcept {
+#if defined(NB_FREE_THREADED)
+    nb_ndarray_type_map &types = nb_thread_state_get(p)->ndarray_types;
+#else
+    nb_ndarray_type_map &types = p->ndarray_types;
+#endif
 
-    // Capsule flavor (versioned or not) to probe for first during extraction.
-    // Defaults to unversioned: the right guess for an unknown user capsule.
-    bool expect_versioned = false;
+    uint32_t version = type_version(tp);
+    if (NB_LIKELY(version)) {
+        nb_ndarray_type_map::iterator it = types.find((void *) tp);
+        if (it != types.end() && it->second.version == version)
+            return it->second;
+    }
 
-    PyTypeObject *tp = Py_TYPE(src);
-    const bool src_is_pycapsule = tp == &PyCapsule_Type;
+#if PY_VERSION_HEX >= 0x030C0000
+    if (!version && PyUnstable_Type_AssignVersionTag(tp))
+        version = type_version(tp);
+#endif
 
-    if (src_is_pycapsule) {
-        capsule = borrow(src);
+    nb_ndarray_type_info info;
+    info.version = version;
+    info.framework = (uint8_t) detect_framework(p, tp);
+    info.has_dlpack = dlpack_method(p, tp).is_valid();
+    info.has_buffer = obj_has_buffer(nullptr, tp);
+    info.is_array_type = is_array_type(tp);
+
+    // Computing the entry may run arbitrary code ('__module__' descriptor)
+    // that modifies the type. Only cache results from an unchanged type.
+    if (version && type_version(tp) == version) {
+        // Entries of deallocated types are never reused (their version tag
+        // cannot recur), so bound the size of the cache instead.
+        if (types.size() >= 1024)
+            types.clear();
+        types[(void *) tp] = info;
+    }
+
+    return info;
+}
+#endif
+
+bool ndarray_check(nb_internals *p, PyObject *o) noexcept {
+    PyTypeObject *tp = Py_TYPE(o);
+
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
+    (void) o;
+    nb_ndarray_type_info info = ndarray_type_info(p, tp);
+    return info.has_dlpack || info.has_buffer || info.is_array_type ||
+           tp == &PyCapsule_Type;
+#else
+    return dlpack_method(p, tp).is_valid() || obj_has_buffer(o, tp) ||
+           tp == &PyCapsule_Type || is_array_type(tp);
+#endif
+}
+
+// ========================================================================
+
+/* Native conversion of CPU arrays to another dtype or memory order. The
+   conversion traverses the array in the order of the (contiguous) output.
+   After merging dimensions that are contiguous in both arrays, it processes
+   one row of the innermost dimension at a time. Converting a row first widens
+   a chunk of elements to int64_t, uint64_t, double, or complex<double>, and
+   then narrows them to the output type. This needs 13 + 4 * 13 kernels instead
+   of one per type pair, and the loops of both steps vectorize. */
+
+template <typename T> struct nd_complex { T re, im; };
+
+template <typename T> constexpr bool nd_is_complex = false;
+template <typename T> constexpr bool nd_is_complex<nd_complex<T>> = true;
+
+// Element types supported by the conversion, in the order of nd_type_index()
+#define NB_ND_TYPES(X)                                                         \
+    X(bool) X(int8_t) X(int16_t) X(int32_t) X(int64_t) X(uint8_t)              \
+    X(uint16_t) X(uint32_t) X(uint64_t) X(float) X(double)                     \
+    X(nd_complex<float>) X(nd_complex<double>)
+
+static constexpr int nd_type_count = 13;
+
+/// Index of 'dt' in NB_ND_TYPES, or -1 if the type is unsupported
+static int nd_type_index(dlpack::dtype dt) noexcept {
+    int l;
+    switch (dt.bits) {
+        case 8: l = 0; break;
+        case 16: l = 1; break;
+        case 32: l = 2; break;
+        case 64: l = 3; break;
+        case 128: l = 4; break;
+        default: return -1;
+    }
+
+    if (dt.lanes != 1)
+        return -1;
+
+    switch ((dlpack::dtype_code) dt.code) {
+        case dlpack::dtype_code::Bool: return l == 0 ? 0 : -1;
+        case dlpack::dtype_code::Int: return l < 4 ? 1 + l : -1;
+        case dlpack::dtype_code::UInt: return l < 4 ? 5 + l : -1;
+        case dlpack::dtype_code::Float: return l == 2 || l == 3 ? 7 + l : -1;
+        case dlpack::dtype_code::Complex: return l == 3 || l == 4 ? 8 + l : -1;
+        default: return -1;
+    }
+}
+
+/// Wide type used to stage values of type 'T'
+template <typename T>
+using nd_wide_t = std::conditional_t<
+    nd_is_complex<T>, nd_complex<double>,
+    std::conditional_t<std::is_floating_point_v<T>, double,
+                       std::conditional_t<std::is_unsigned_v<T> &&
+                                              !std::is_same_v<T, bool>,
+                                          uint64_t, int64_t>>>;
+
+/// Index of the wide type of 'T' (int64_t, uint64_t, double, complex<double>)
+template <typename T> constexpr int nd_wide_index =
+    nd_is_complex<T> ? 3 : std::is_floating_point_v<T> ? 2 :
+    (std::is_unsigned_v<T> && !std::is_same_v<T, bool>) ? 1 : 0;
+
+/// Convert an element. Complex values convert to bool if either component is
+/// nonzero, and otherwise to real types via their real part. Converting a
+/// floating point value that the target type cannot represent is undefined
+/// behavior in C++, so such conversions saturate instead: NaN becomes zero,
+/// and values beyond the range of an integer type clamp to its bounds.
+/// 'double' values beyond the range of 'float' become infinite.
+template <typename Out, typename In> NB_INLINE Out nd_cast(In value) {
+    if constexpr (nd_is_complex<Out>) {
+        using T = decltype(Out::re);
+        if constexpr (nd_is_complex<In>)
+            return { nd_cast<T>(value.re), nd_cast<T>(value.im) };
+        else
+            return { nd_cast<T>(value), (T) 0 };
+    } else if constexpr (nd_is_complex<In>) {
+        if constexpr (std::is_same_v<Out, bool>)
+            return value.re != 0 || value.im != 0;
+        else
+            return nd_cast<Out>(value.re);
+    } else if constexpr (std::is_same_v<Out, bool>) {
+        return value != 0;
+    } else if constexpr (std::is_integral_v<Out> &&
+                         std::is_floating_point_v<In>) {
+        // The bounds convert exactly, or round up to a power of two for
+        // 64-bit types, so values between them are in range
+        constexpr In lo = (In) std::numeric_limits<Out>::min(),
+                     hi = (In) std::numeric_limits<Out>::max();
+        if (value != value)
+            return 0;
+        else if (value <= lo)
+            return std::numeric_limits<Out>::min();
+        else if (value >= hi)
+            return std::numeric_limits<Out>::max();
+        else
+            return (Out) value;
+    } else if constexpr (std::is_same_v<Out, float> &&
+                         std::is_same_v<In, double>) {
+        constexpr double max = (double) std::numeric_limits<float>::max();
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        if (value > max)
+            return inf;
+        else if (value < -max)
+            return -inf;
+        else
+            return (float) value;
     } else {
-        // __dlpack__ is by contract a plain method, so call the looked-up
-        // descriptor directly (args[0] is self) rather than re-resolving it.
-        object dlpack_descr = dlpack_method(p, tp);
+        return (Out) value;
+    }
+}
 
-        if (dlpack_descr.is_valid()) {
-            PyObject* args[] = {src, NB_INTERNED(p, dl_version_tpl)};
-            size_t nargsf = 1 | PY_VECTORCALL_ARGUMENTS_OFFSET;
+/// Widen 'n' elements of type 'In' spaced 'stride' bytes apart
+template <typename In>
+static void nd_widen(void *out_, const uint8_t *in, int64_t stride,
+                     size_t n) noexcept {
+    using W = nd_wide_t<In>;
+    W *out = (W *) out_;
+    In value;
+
+    if (stride == (int64_t) sizeof(In)) {
+        for (size_t i = 0; i < n; ++i) {
+            memcpy(&value, in + i * sizeof(In), sizeof(In));
+            out[i] = nd_cast<W>(value);
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            memcpy(&value, in + (int64_t) i * stride, sizeof(In));
+            out[i] = nd_cast<W>(value);
+        }
+    }
+}
 
-            // max_version_kw requests a versioned capsule, nullptr the cheaper
-            // unversioned one.
-            PyObject *max_version_kw = NB_INTERNED(p, max_version_tpl);
-            auto dlpack = [&](PyObject *kwnames) {
-                return steal(PyObject_Vectorcall(dlpack_descr.ptr(), args,
-                                                 nargsf, kwnames));
-            };
+/// Narrow 'n' contiguous elements of type 'W' to type 'Out'
+template <typename Out, typename W>
+static void nd_narrow(uint8_t *out_, const void *in_, size_t n) noexcept {
+    Out *out = (Out *) out_;
+    const W *in = (const W *) in_;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = nd_cast<Out>(in[i]);
+}
 
-            // The unversioned path is generally faster to handle for the target
-            // framework. Try that first if the user only requested readonly input.
-            capsule = dlpack(cfg.ro ? nullptr : max_version_kw);
-            expect_versioned = !cfg.ro;
+using nd_widen_fn = void (*)(void *, const uint8_t *, int64_t, size_t) noexcept;
+using nd_narrow_fn = void (*)(uint8_t *, const void *, size_t) noexcept;
 
-            // Fall back to the other variant on failure: a read-only source
-            // refusing unversioned export raises BufferError, and producers
-            // predating max_version (array API < v2023) raise TypeError.
-            if (!capsule.is_valid() &&
-                (PyErr_ExceptionMatches(PyExc_BufferError) ||
-                 PyErr_ExceptionMatches(PyExc_TypeError))) {
-                PyErr_Clear();
-                capsule = dlpack(cfg.ro ? max_version_kw : nullptr);
-                expect_versioned = cfg.ro;
+#define NB_ND_WIDEN(T) nd_widen<T>,
+#define NB_ND_WIDE_INDEX(T) nd_wide_index<T>,
+static constexpr nd_widen_fn nd_widen_table[] = { NB_ND_TYPES(NB_ND_WIDEN) };
+static constexpr int nd_wide_table[] = { NB_ND_TYPES(NB_ND_WIDE_INDEX) };
+
+#define NB_ND_NARROW(T) nd_narrow<T, W>,
+template <typename W> struct nd_narrow_row {
+    static constexpr nd_narrow_fn fn[] = { NB_ND_TYPES(NB_ND_NARROW) };
+};
+
+static constexpr const nd_narrow_fn *nd_narrow_table[] = {
+    nd_narrow_row<int64_t>::fn, nd_narrow_row<uint64_t>::fn,
+    nd_narrow_row<double>::fn, nd_narrow_row<nd_complex<double>>::fn
+};
+
+#undef NB_ND_NARROW
+#undef NB_ND_WIDE_INDEX
+#undef NB_ND_WIDEN
+#undef NB_ND_TYPES
+
+static void nd_free_capsule(PyObject *o) noexcept {
+    PyMem_Free(PyCapsule_GetPointer(o, nullptr));
+}
+
+/// Description of a copy from a strided source into a contiguous target
+struct nd_copy_plan {
+    const uint8_t *src;
+    uint8_t *dst;
+
+    /// Merged dimensions from the innermost outwards (strides in bytes)
+    int64_t shape[max_ndim], strides[max_ndim];
+    int32_t ndim;
+
+    size_t in_size, out_size;
+
+    /// Conversion kernels, or nullptr if the dtypes are the same
+    nd_widen_fn widen;
+    nd_narrow_fn narrow;
+};
+
+/// Copy the elements 'first' to 'last' (exclusive, in the order of the target)
+static void nd_copy_range(const nd_copy_plan &c, size_t first,
+                          size_t last) noexcept {
+    constexpr size_t chunk = 256;
+    alignas(16) uint8_t tmp[chunk * sizeof(nd_complex<double>)];
+    int64_t index[max_ndim];
+
+    size_t n = (size_t) c.shape[0], i = first % n, r = first / n;
+    int64_t stride = c.strides[0];
+
+    // Position the source pointer at the start of row 'r'
+    const uint8_t *row = c.src;
+    for (int32_t k = 1; k < c.ndim; ++k) {
+        index[k] = (int64_t) (r % (size_t) c.shape[k]);
+        r /= (size_t) c.shape[k];
+        row += index[k] * c.strides[k];
+    }
+
+    uint8_t *out = c.dst + first * c.out_size;
+    while (first < last) {
+        size_t m = std::min(n - i, last - first);
+        const uint8_t *in = row + (int64_t) i * stride;
+
+        if (!c.widen) {
+            if (stride == (int64_t) c.in_size) {
+                memcpy(out, in, m * c.in_size);
+            } else {
+                for (size_t j = 0; j < m; ++j)
+                    memcpy(out + j * c.in_size, in + (int64_t) j * stride,
+                           c.in_size);
+            }
+        } else {
+            for (size_t j = 0; j < m; j += chunk) {
+                size_t l = std::min(chunk, m - j);
+                c.widen(tmp, in + (int64_t) j * stride, stride, l);
+                c.narrow(out + j * c.out_size, tmp, l);
             }
+        }
 
-            if (!capsule.is_valid())
-                PyErr_Clear();
+        out += m * c.out_size;
+        first += m;
+        i = 0;
+
+        // Advance to the next row
+        for (int32_t k = 1; k < c.ndim; ++k) {
+            row += c.strides[k];
+            if (++index[k] < c.shape[k])
+                break;
+            row -= c.strides[k] * c.shape[k];
+            index[k] = 0;
         }
+    }
+}
 
-        // Fall back to the buffer protocol, again gated on a non-raising probe.
-        if (!capsule.is_valid() && obj_has_buffer(src, tp))
-            mt_unique_ptr = make_mt_from_buffer_protocol(src, cfg.ro);
+/// Copy 'size' elements, splitting large copies across several threads. The
+/// threads only exist during the copy, since their creation cost is small
+/// compared to that of a copy above the threshold.
+static void nd_copy(nb_internals *p, const nd_copy_plan &c, size_t size) {
+    size_t bytes = size * std::max(c.in_size, c.out_size);
+    uint32_t threads = p->ndarray_copy_threads;
 
-        // Try the function to_dlpack(), already obsolete in array API v2021
-        if (!mt_unique_ptr && !capsule.is_valid()) {
-            const char *pkg =
-                importers[detect_framework(p, tp)].to_dlpack_pkg;
-            if (pkg) {
-                try {
-                    object package = module_::import_(pkg);
-                    if (package.is_valid())
-                        capsule = obj_call(
-                            p, str_getattr(p, package, "to_dlpack"),
-                            handle(src));
-                } catch (...) {
-                    capsule.reset();
-                }
-            }
-            if (!capsule.is_valid())
-                return nullptr;
+    if (threads == 0)
+        threads = std::min(std::thread::hardware_concurrency(), 8u);
+
+    // Give each thread at least 64 KiB of work
+    threads = (uint32_t) std::min((size_t) threads, bytes >> 16);
+
+    if (bytes < p->ndarray_copy_threshold || threads <= 1) {
+        nd_copy_range(c, 0, size);
+        return;
+    }
+
+    std::thread workers[64];
+    threads = std::min(threads, 64u);
+    size_t step = (size + threads - 1) / threads;
+
+    PyThreadState *state = PyEval_SaveThread();
+
+    uint32_t started = 0;
+    size_t done = step;
+    try {
+        for (; started < threads - 1 && done < size; ++started, done += step)
+            workers[started] = std::thread(nd_copy_range, std::cref(c), done,
+                                           std::min(done + step, size));
+    } catch (...) {
+        // Copy the rest on this thread if a thread cannot be created
+    }
+
+    nd_copy_range(c, 0, step);
+    if (done < size)
+        nd_copy_range(c, done, size);
+
+    for (uint32_t i = 0; i < started; ++i)
+        workers[i].join();
+
+    PyEval_RestoreThread(state);
+}
+
+static ndarray_handle *ndarray_convert_impl(nb_internals *p,
+                                            const dlpack::dltensor &t,
+                                            dlpack::dtype dt, char order,
+                                            bool ro, cleanup_list *cleanup) {
+    bool same_dtype = t.dtype == dt;
+    int in_index = nd_type_index(t.dtype),
+        out_index = nd_type_index(dt);
+
+    if (!same_dtype && (in_index < 0 || out_index < 0))
+        return nullptr;
+
+    size_t in_size = ((size_t) t.dtype.bits * t.dtype.lanes) / 8,
+           out_size = ((size_t) dt.bits * dt.lanes) / 8;
+    if (in_size * 8 != (size_t) t.dtype.bits * t.dtype.lanes ||
+        out_size * 8 != (size_t) dt.bits * dt.lanes || !in_size)
+        return nullptr;
+
+    int32_t ndim = t.ndim;
+    size_t size = 1;
+    int64_t strides[max_ndim];
+    for (int32_t i = ndim - 1; i >= 0; --i) {
+        strides[i] = t.strides ? t.strides[i] : (int64_t) size;
+        size *= (size_t) t.shape[i];
+    }
+
+    // Keep Fortran order if no order is required, like NumPy's astype()
+    if (order != 'C' && order != 'F') {
+        bool f_order = ndim > 1;
+        for (int64_t i = 0, accum = 1; i < ndim && f_order; ++i) {
+            f_order = t.shape[i] == 1 || strides[i] == accum;
+            accum *= t.shape[i];
         }
+        order = f_order ? 'F' : 'C';
     }
 
-    void* mt;  // can be versioned or unversioned
-    bool versioned;
-    if (mt_unique_ptr) {
-        mt = mt_unique_ptr.get();
-        versioned = true;
-    } else {
-        // Probe the expected capsule name first
-        static const char *names[2] = { "dltensor", "dltensor_versioned" };
-        versioned = expect_versioned;
-        mt = PyCapsule_GetPointer(capsule.ptr(), names[(int) versioned]);
-        if (!mt) {
-            PyErr_Clear();
-            versioned = !versioned;
-            mt = PyCapsule_GetPointer(capsule.ptr(), names[(int) versioned]);
-            if (!mt) {
-                PyErr_Clear();
-                return nullptr;
-            }
+    // Dimensions in the order of the output from the innermost outwards, with
+    // unit-size ones dropped and contiguous neighbors merged. Strides in bytes.
+    nd_copy_plan c;
+    int64_t *shape_m = c.shape, *strides_m = c.strides;
+    int32_t ndim_m = 0;
+    for (int32_t k = 0; k < ndim; ++k) {
+        int32_t i = order == 'C' ? ndim - 1 - k : k;
+        int64_t extent = t.shape[i], stride = strides[i] * (int64_t) in_size;
+        if (extent == 1)
+            continue;
+        if (ndim_m > 0 &&
+            stride == strides_m[ndim_m - 1] * shape_m[ndim_m - 1]) {
+            shape_m[ndim_m - 1] *= extent;
+        } else {
+            shape_m[ndim_m] = extent;
+            strides_m[ndim_m] = stride;
+            ndim_m++;
         }
     }
 
-    dlpack::dltensor& t = (versioned)
-                              ? ((managed_dltensor_versioned *) mt)->dltensor
-                              : ((managed_dltensor *) mt)->dltensor;
+    if (ndim_m == 0) {
+        shape_m[0] = 1;
+        strides_m[0] = (int64_t) in_size;
+        ndim_m = 1;
+    }
 
-    uint64_t flags = (versioned) ? ((managed_dltensor_versioned *) mt)->flags
-                                 : 0UL;
+    // Fall back to the framework if the allocation fails
+    if (size > SIZE_MAX / out_size)
+        return nullptr;
+    void *data = PyMem_Malloc(size ? size * out_size : 1);
+    if (!data)
+        return nullptr;
 
-    if (t.ndim < 0 || t.ndim > max_ndim)
+    object owner = steal(PyCapsule_New(data, nullptr, nd_free_capsule));
+    if (!owner.is_valid()) {
+        PyErr_Clear();
+        PyMem_Free(data);
         return nullptr;
+    }
 
-    // Reject a read-only ndarray if a writable one is required, and
-    // reject an ndarray not on the required device.
-    if ((!cfg.ro && (flags & dlpack::flag_bitmask_read_only))
-        || (cfg.device_type != 0 && t.device.device_type != cfg.device_type)) {
+    c.src = (const uint8_t *) t.data + t.byte_offset;
+    c.dst = (uint8_t *) data;
+    c.ndim = ndim_m;
+    c.in_size = in_size;
+    c.out_size = out_size;
+    c.widen = nullptr;
+    c.narrow = nullptr;
+    if (!same_dtype) {
+        c.widen = nd_widen_table[in_index];
+        c.narrow = nd_narrow_table[nd_wide_table[in_index]][out_index];
+    }
+
+    if (size)
+        nd_copy(p, c, size);
+
+    size_t shape[max_ndim];
+    for (int32_t i = 0; i < ndim; ++i)
+        shape[i] = (size_t) t.shape[i];
+
+    ndarray_create_args args { };
+    args.data = data;
+    args.shape = shape;
+    args.owner = owner.ptr();
+    args.ndim = (uint32_t) ndim;
+    args.device_type = device::cpu::value;
+    args.dtype = dt;
+    args.order = order;
+    args.ro = ro;
+
+    ndarray_handle *h = ndarray_create(p, &args);
+    if (cleanup)
+        cleanup->append(owner.release().ptr());
+    return h;
+}
+
+/// Copy the CPU tensor 't' into a new array with dtype 'dt' and memory order
+/// 'order' ('C', 'F', or any). Returns nullptr if the dtypes are unsupported.
+static ndarray_handle *ndarray_convert(nb_internals *p,
+                                       const dlpack::dltensor &t,
+                                       dlpack::dtype dt, char order, bool ro,
+                                       cleanup_list *cleanup) noexcept {
+    try {
+        return ndarray_convert_impl(p, t, dt, order, ro, cleanup);
+    } catch (...) {
         return nullptr;
     }
+}
 
-    // Check if the ndarray satisfies the remaining requirements.
+// Helper function reports whether `code` represents a complex number.
+static NB_INLINE bool dtype_code_is_complex(uint8_t code) {
+    return code == (uint8_t) dlpack::dtype_code::Complex ||
+           code == (uint8_t) dlpack::dtype_code::Bcomplex;
+}
+
+/// Check the dtype, shape, and memory order of 't' against 'cfg'
+static void nd_match(const ndarray_config &cfg, const dlpack::dltensor &t,
+                     bool &pass_dtype, bool &pass_shape,
+                     bool &pass_order) noexcept {
     bool has_dtype = cfg.dtype != dlpack::dtype(),
          has_shape = cfg.ndim != -1,
          has_order = cfg.order != '\0';
 
-    bool pass_dtype = true, pass_shape = true, pass_order = true;
+    pass_dtype = pass_shape = pass_order = true;
 
     if (has_dtype)
         pass_dtype = t.dtype == cfg.dtype;
@@ -900,15 +1371,259 @@ static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
             pass_order = c_order || f_order;
         }
     }
+}
 
-    // Do not convert shape and do not convert complex numbers to non-complex.
-    convert &= pass_shape &
+/// Is 'tp' an 'nb_ndarray' type whose handles this backend can reference?
+/// This includes the type registered in the domain 'p' (possibly created by
+/// another extension with its own copy of the backend), and the types of
+/// other domains created by this copy of the backend, which share the
+/// layout of 'ndarray_handle'. Handles record their own domain.
+static bool is_nb_ndarray(nb_internals *p, PyTypeObject *tp) noexcept {
+    if (tp == p->nb_ndarray.load_acquire())
+        return true;
+#if defined(Py_LIMITED_API)
+    return PyType_GetSlot(tp, Py_tp_dealloc) == (void *) nb_ndarray_dealloc;
+#else
+    return tp->tp_dealloc == nb_ndarray_dealloc;
+#endif
+}
+
+/* Arrays returned by one binding (e.g., with the 'array_api' framework) are
+   often passed straight into another one. Import them without a '__dlpack__'
+   round trip by referencing the handle of the 'nb_ndarray' object. The handle
+   is shared when its read-only status matches the request. A writable array
+   passed to a read-only parameter receives a new handle instead, which
+   references the same tensor and keeps 'src' alive. Returns nullptr (without
+   an error) if the array needs the general path, e.g. for a conversion. */
+static ndarray_handle *ndarray_import_nb(nb_internals *p, PyObject *src,
+                                         const ndarray_config &cfg) noexcept {
+    ndarray_handle *th = ((nb_ndarray *) src)->th;
+    const dlpack::dltensor &t = th->tensor();
+
+    if ((!cfg.ro && th->ro) ||
+        (cfg.device_type != 0 && t.device.device_type != cfg.device_type))
+        return nullptr;
+
+    bool pass_dtype, pass_shape, pass_order;
+    nd_match(cfg, t, pass_dtype, pass_shape, pass_order);
+    if (!pass_dtype || !pass_shape || !pass_order)
+        return nullptr;
+
+    if (th->ro == cfg.ro)
+        return th;
+
+    size_t shape[max_ndim];
+    for (int32_t i = 0; i < t.ndim; ++i)
+        shape[i] = (size_t) t.shape[i];
+
+    ndarray_create_args args;
+    args.data = t.data;
+    args.shape = shape;
+    args.strides = t.strides;
+    args.owner = src;
+    args.byte_offset = t.byte_offset;
+    args.ndim = (uint32_t) t.ndim;
+    args.flags = NB_ABI_MINOR_TAG;
+    args.device_type = t.device.device_type;
+    args.device_id = t.device.device_id;
+    args.dtype = t.dtype;
+    args.order = '\0';
+    args.ro = true;
+    args.unused = 0;
+    return ndarray_create(p, &args);
+}
+
+/// Type lookups shared by consecutive arguments of ndarray_import_n()
+struct nd_import_memo {
+    PyTypeObject *tp = nullptr;
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
+    nb_ndarray_type_info info { };
+#endif
+    object dlpack_descr;
+};
+
+static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
+                                           const ndarray_config &cfg,
+                                           bool convert,
+                                           cleanup_list *cleanup,
+                                           nd_import_memo *memo = nullptr) noexcept {
+    object capsule;
+    mt_unique_ptr_t mt_unique_ptr(nullptr, &mt_from_buffer_delete);
+
+    // Capsule flavor (versioned or not) to probe for first during extraction.
+    // Defaults to unversioned: the right guess for an unknown user capsule.
+    bool expect_versioned = false;
+
+    PyTypeObject *tp = Py_TYPE(src);
+    const bool src_is_pycapsule = tp == &PyCapsule_Type;
+
+    if (is_nb_ndarray(p, tp)) {
+        ndarray_handle *h = ndarray_import_nb(p, src, cfg);
+        if (h)
+            return h;
+    }
+
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
+    // Reuse the lookups of the previous argument if it had the same type
+    // (whose version tag shows that it hasn't been modified since)
+    bool memo_hit = memo && memo->tp == tp && memo->info.version &&
+                    type_version(tp) == memo->info.version;
+
+    nb_ndarray_type_info info{};
+    if (memo_hit) {
+        info = memo->info;
+    } else if (!src_is_pycapsule) {
+        info = ndarray_type_info(p, tp);
+        if (memo) {
+            memo->tp = tp;
+            memo->info = info;
+            memo->dlpack_descr.reset();
+        }
+    }
+    const bool has_dlpack = info.has_dlpack, has_buffer = info.has_buffer;
+    auto framework = [&]() -> int { return info.framework; };
+#else
+    const bool memo_hit = false;
+    (void) memo;
+    const bool has_dlpack = true, has_buffer = obj_has_buffer(src, tp);
+    auto framework = [&]() -> int { return detect_framework(p, tp); };
+#endif
+
+    if (src_is_pycapsule) {
+        capsule = borrow(src);
+    } else {
+        // __dlpack__ is by contract a plain method, so call the looked-up
+        // descriptor directly (args[0] is self) rather than re-resolving it.
+        object dlpack_descr;
+        if (has_dlpack) {
+            if (memo_hit && memo->dlpack_descr.is_valid()) {
+                dlpack_descr = memo->dlpack_descr;
+            } else {
+                dlpack_descr = dlpack_method(p, tp);
+                if (memo)
+                    memo->dlpack_descr = dlpack_descr;
+            }
+        }
+
+        if (dlpack_descr.is_valid()) {
+            PyObject* args[] = {src, NB_INTERNED(p, dl_version_tpl)};
+            size_t nargsf = 1 | PY_VECTORCALL_ARGUMENTS_OFFSET;
+
+            // max_version_kw requests a versioned capsule, nullptr the cheaper
+            // unversioned one.
+            PyObject *max_version_kw = NB_INTERNED(p, max_version_tpl);
+            auto dlpack = [&](PyObject *kwnames) {
+                return steal(PyObject_Vectorcall(dlpack_descr.ptr(), args,
+                                                 nargsf, kwnames));
+            };
+
+            // The unversioned path is generally faster to handle for the target
+            // framework. Try that first if the user only requested readonly input.
+            capsule = dlpack(cfg.ro ? nullptr : max_version_kw);
+            expect_versioned = !cfg.ro;
+
+            // Fall back to the other variant on failure: a read-only source
+            // refusing unversioned export raises BufferError, and producers
+            // predating max_version (array API < v2023) raise TypeError.
+            if (!capsule.is_valid() &&
+                (PyErr_ExceptionMatches(PyExc_BufferError) ||
+                 PyErr_ExceptionMatches(PyExc_TypeError))) {
+                PyErr_Clear();
+                capsule = dlpack(cfg.ro ? max_version_kw : nullptr);
+                expect_versioned = cfg.ro;
+            }
+
+            if (!capsule.is_valid())
+                PyErr_Clear();
+        }
+
+        // Fall back to the buffer protocol, again gated on a non-raising probe.
+        if (!capsule.is_valid() && has_buffer)
+            mt_unique_ptr = make_mt_from_buffer_protocol(src, cfg.ro);
+
+        // Try the function to_dlpack(), already obsolete in array API v2021
+        if (!mt_unique_ptr && !capsule.is_valid()) {
+            const char *pkg =
+                importers[framework()].to_dlpack_pkg;
+            if (pkg) {
+                try {
+                    object package = module_::import_(pkg);
+                    if (package.is_valid())
+                        capsule = obj_call(
+                            p, str_getattr(p, package, "to_dlpack"),
+                            handle(src));
+                } catch (...) {
+                    capsule.reset();
+                }
+            }
+            if (!capsule.is_valid())
+                return nullptr;
+        }
+    }
+
+    void* mt;  // can be versioned or unversioned
+    bool versioned;
+    if (mt_unique_ptr) {
+        mt = mt_unique_ptr.get();
+        versioned = true;
+    } else {
+        // Probe the expected capsule name first
+        static const char *names[2] = { "dltensor", "dltensor_versioned" };
+        versioned = expect_versioned;
+        mt = PyCapsule_GetPointer(capsule.ptr(), names[(int) versioned]);
+        if (!mt) {
+            PyErr_Clear();
+            versioned = !versioned;
+            mt = PyCapsule_GetPointer(capsule.ptr(), names[(int) versioned]);
+            if (!mt) {
+                PyErr_Clear();
+                return nullptr;
+            }
+        }
+    }
+
+    dlpack::dltensor& t = (versioned)
+                              ? ((managed_dltensor_versioned *) mt)->dltensor
+                              : ((managed_dltensor *) mt)->dltensor;
+
+    uint64_t flags = (versioned) ? ((managed_dltensor_versioned *) mt)->flags
+                                 : 0UL;
+
+    if (t.ndim < 0 || t.ndim > max_ndim)
+        return nullptr;
+
+    // Reject a read-only ndarray if a writable one is required, and
+    // reject an ndarray not on the required device.
+    if ((!cfg.ro && (flags & dlpack::flag_bitmask_read_only))
+        || (cfg.device_type != 0 && t.device.device_type != cfg.device_type)) {
+        return nullptr;
+    }
+
+    // Check if the ndarray satisfies the remaining requirements.
+    bool has_dtype = cfg.dtype != dlpack::dtype();
+    bool pass_dtype, pass_shape, pass_order;
+    nd_match(cfg, t, pass_dtype, pass_shape, pass_order);
+
+    // Do not convert shape and do not convert complex numbers to non-complex.
+    convert &= pass_shape &
                !(dtype_code_is_complex(t.dtype.code) &&
                  has_dtype && !dtype_code_is_complex(cfg.dtype.code));
 
-    // Support implicit conversion of dtype and order.
+    // Support implicit conversion of dtype and order. Convert CPU arrays
+    // natively, and ask the source framework to convert everything else.
+    if (convert && (!pass_dtype || !pass_order) &&
+        t.device.device_type == device::cpu::value) {
+        ndarray_handle *h = ndarray_convert(
+            p, t, has_dtype ? cfg.dtype : t.dtype, cfg.order, cfg.ro, cleanup);
+        if (h) {
+            if (!src_is_pycapsule)
+                h->framework = (uint8_t) framework();
+            return h;
+        }
+    }
+
     if (convert && (!pass_dtype || !pass_order) && !src_is_pycapsule) {
-        int fw = detect_framework(p, tp);
+        int fw = framework();
 
         char order = 'K'; // for NumPy. 'K' means 'keep'
         if (cfg.order)
@@ -963,8 +1678,8 @@ static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
     if (!pass_dtype || !pass_shape || !pass_order)
         return nullptr;
 
-    // Create a reference-counted wrapper
-    scoped_pymalloc<ndarray_handle> result;
+    // Create a reference-counted wrapper, with room for strides if needed
+    ndarray_handle *result = ndarray_handle_alloc(p, t.strides ? 0 : t.ndim);
     if (versioned)
         result->mt_versioned = (managed_dltensor_versioned *) mt;
     else
@@ -975,6 +1690,7 @@ static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
     result->versioned = versioned;
     result->call_deleter = true;
     result->ro = cfg.ro;
+    result->framework = no_framework::value;
 
     if (src_is_pycapsule) {
         result->self = nullptr;
@@ -988,13 +1704,13 @@ static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
     } else {
         result->free_strides = true;
 
-        scoped_pymalloc<int64_t> strides((size_t) t.ndim);
+        int64_t *strides = ndarray_block_dims(result);
         int64_t accum = 1;
         for (int32_t i = t.ndim - 1; i >= 0; --i) {
-            strides[(size_t) i] = accum;
+            strides[i] = accum;
             accum *= t.shape[i];
         }
-        t.strides = strides.release();
+        t.strides = strides;
     }
 
     if (capsule.is_valid()) {
@@ -1016,7 +1732,7 @@ static ndarray_handle *ndarray_import_impl(nb_internals *p, PyObject *src,
     }
 
     mt_unique_ptr.release();
-    return result.release();
+    return result;
 }
 
 ndarray_handle *ndarray_import(nb_internals *p, PyObject *src,
@@ -1026,6 +1742,72 @@ ndarray_handle *ndarray_import(nb_internals *p, PyObject *src,
     return ndarray_import_impl(p, src, *c, convert, cleanup);
 }
 
+/// Release a handle returned by ndarray_import() that has no references yet
+static void ndarray_import_discard(ndarray_handle *th) noexcept {
+    if (th) {
+        ++th->refcount;
+        ndarray_dec_ref(th);
+    }
+}
+
+bool ndarray_import_n(nb_internals *p, ndarray_import_entry *e, size_t n,
+                      const uint32_t *links, size_t nlinks, bool remember,
+                      cleanup_list *cleanup) noexcept {
+    nd_import_memo memo;
+    size_t i = 0;
+
+    for (; i < n; ++i) {
+        ndarray_import_entry &entry = e[i];
+        PyObject *src = *entry.src;
+        entry.result = nullptr;
+
+        if (src == Py_None && (entry.flags & cast_flags::accepts_none))
+            continue;
+
+        size_t size_before = cleanup ? cleanup->size() : 0;
+        entry.result = ndarray_import_impl(
+            p, src, *entry.config, entry.flags & cast_flags::convert, cleanup,
+            &memo);
+        if (!entry.result)
+            break;
+
+        // Let keep_alive annotations and call policies see converted arrays
+        if (remember && cleanup && cleanup->size() != size_before)
+            *entry.src = (*cleanup)[cleanup->size() - 1];
+    }
+
+    // Verify that linked arguments agree in the requested dimension
+    bool success = i == n;
+    for (size_t j = 0; success && j + 2 <= nlinks; ) {
+        uint32_t axis = links[j], count = links[j + 1];
+        const uint32_t *entries = links + j + 2;
+        int64_t extent = -1;
+        j += 2 + count;
+
+        for (uint32_t k = 0; k < count; ++k) {
+            ndarray_handle *th = e[entries[k]].result;
+            if (!th) // 'None'
+                continue;
+            const dlpack::dltensor &t = th->tensor();
+            if (axis >= (uint32_t) t.ndim ||
+                (extent >= 0 && t.shape[axis] != extent)) {
+                success = false;
+                break;
+            }
+            extent = t.shape[axis];
+        }
+    }
+
+    if (!success) {
+        for (size_t j = 0; j < n && j <= i; ++j) {
+            ndarray_import_discard(e[j].result);
+            e[j].result = nullptr;
+        }
+    }
+
+    return success;
+}
+
 dlpack::dltensor *ndarray_inc_ref(ndarray_handle *th) noexcept {
     if (!th)
         return nullptr;
@@ -1037,29 +1819,22 @@ dlpack::dltensor *ndarray_inc_ref(ndarray_handle *th) noexcept {
 static void ndarray_dec_ref_free(ndarray_handle *th) noexcept {
     Py_XDECREF(th->owner);
     Py_XDECREF(th->self);
+    // Added strides and the tensor of ndarray_create() live in the handle block
     if (th->versioned) {
         managed_dltensor_versioned *mt = th->mt_versioned;
-        if (th->free_strides) {
-            PyMem_Free(mt->dltensor.strides);
+        if (th->free_strides)
             mt->dltensor.strides = nullptr;
-        }
-        if (th->call_deleter) {
-            if (mt->deleter)
-                mt->deleter(mt);
-        } else {
-            PyMem_Free(mt);  // This also frees shape and size arrays.
-        }
+        if (th->call_deleter && mt->deleter)
+            mt->deleter(mt);
     } else {
         managed_dltensor *mt = th->mt_unversioned;
-        if (th->free_strides) {
-            PyMem_Free(mt->dltensor.strides);
+        if (th->free_strides)
             mt->dltensor.strides = nullptr;
-        }
         assert(th->call_deleter);
         if (mt->deleter)
             mt->deleter(mt);
     }
-    PyMem_Free(th);
+    ndarray_handle_free(th);
 }
 
 void ndarray_dec_ref(ndarray_handle *th) noexcept {
@@ -1076,7 +1851,7 @@ void ndarray_dec_ref(ndarray_handle *th) noexcept {
     }
 }
 
-ndarray_handle *ndarray_create(nb_internals *, const ndarray_create_args *a) {
+ndarray_handle *ndarray_create(nb_internals *p, const ndarray_create_args *a) {
     ndarray_create_args args = *a;
 
     check(args.ndim <= (size_t) max_ndim,
@@ -1094,13 +1869,13 @@ ndarray_handle *ndarray_create(nb_internals *, const ndarray_create_args *a) {
     if (args.device_type == 0)
         args.device_type = device::cpu::value;
 
-    static_assert(alignof(managed_dltensor_versioned) >= alignof(int64_t));
-    scoped_pymalloc<managed_dltensor_versioned> mt(
-        1, 2 * sizeof(int64_t) * args.ndim);
+    static_assert(sizeof(ndarray_block) % alignof(int64_t) == 0);
+    ndarray_handle *result = ndarray_handle_alloc(p, (int32_t) args.ndim);
+    managed_dltensor_versioned *mt = ndarray_block_mt(result);
     int64_t* shape = nullptr;
     int64_t* strides = nullptr;
     if (args.ndim > 0) {
-        shape = new ((void*) (mt.get() + 1)) int64_t[2 * args.ndim];
+        shape = ndarray_block_dims(result);
         strides = shape + args.ndim;
     }
 
@@ -1128,10 +1903,8 @@ ndarray_handle *ndarray_create(nb_internals *, const ndarray_create_args *a) {
         }
     }
 
-    scoped_pymalloc<ndarray_handle> result;
-
     mt->version = {dlpack::major_version, dlpack::minor_version};
-    mt->manager_ctx = result.get();
+    mt->manager_ctx = result;
     mt->deleter = [](managed_dltensor_versioned *self) {
                       ndarray_dec_ref((ndarray_handle *) self->manager_ctx);
                   };
@@ -1144,7 +1917,7 @@ ndarray_handle *ndarray_create(nb_internals *, const ndarray_create_args *a) {
     mt->dltensor.shape = shape;
     mt->dltensor.strides = strides;
     mt->dltensor.byte_offset = args.byte_offset;
-    result->mt_versioned = mt.release();
+    result->mt_versioned = mt;
     result->refcount = 0;
     result->owner = Py_XNewRef(args.owner);
     result->self = nullptr;
@@ -1152,7 +1925,8 @@ ndarray_handle *ndarray_create(nb_internals *, const ndarray_create_args *a) {
     result->free_strides = false;
     result->call_deleter = false;
     result->ro = args.ro;
-    return result.release();
+    result->framework = no_framework::value;
+    return result;
 }
 
 /// Module + attribute of export callables, indexed by `ndarray_export_slot`.
@@ -1191,11 +1965,20 @@ static PyObject *ndarray_export_fn(nb_internals *internals_,
     return fn;
 }
 
+static PyObject *ndarray_export_new(nb_internals *p, ndarray_handle *th,
+                                    int framework, bool copy) noexcept;
+static PyObject *ndarray_export_cached(nb_internals *p, ndarray_handle *th,
+                                       int framework) noexcept;
+
 PyObject *ndarray_export(nb_internals *p, ndarray_handle *th, int framework,
                          rv_policy policy, cleanup_list *cleanup) noexcept {
     if (!th)
         return none().release().ptr();
 
+    // Return arrays converted by ndarray_import() in their source framework
+    if (framework == no_framework::value && !th->self)
+        framework = th->framework;
+
     bool copy;
     switch (policy) {
         case rv_policy::reference_internal:
@@ -1250,6 +2033,14 @@ PyObject *ndarray_export(nb_internals *p, ndarray_handle *th, int framework,
         return nullptr;
     }
 
+    if (!copy && p->ndarray_export_cache)
+        return ndarray_export_cached(p, th, framework);
+
+    return ndarray_export_new(p, th, framework, copy);
+}
+
+static PyObject *ndarray_export_new(nb_internals *p, ndarray_handle *th,
+                                    int framework, bool copy) noexcept {
     nb_internals *internals_ = p;
 
     object o;
@@ -1334,5 +2125,607 @@ PyObject *ndarray_export(nb_internals *p, ndarray_handle *th, int framework,
     return o.release().ptr();
 }
 
+/* Accessor-style bindings often create a new nb::ndarray referencing the same
+   memory on every call. When enabled via nb::set_ndarray_export_cache(),
+   exports that don't copy reuse the object of an identical earlier export
+   while it is still alive. The cache holds weak references and is bounded
+   in size. Objects that don't support weak references aren't cached.
+
+   Callers can invalidate a returned object (e.g., by releasing a memoryview,
+   or by reshaping a NumPy array in place). A hit is therefore only reused
+   after checking via the buffer protocol that the object still describes
+   the key. This restricts the cache to CPU arrays of frameworks whose
+   objects provide buffers. */
+
+static nb_ndarray_export_map &ndarray_exports(nb_internals *p) noexcept {
+#if defined(NB_FREE_THREADED)
+    return nb_thread_state_get(p)->ndarray_exports;
+#else
+    return p->ndarray_exports;
+#endif
+}
+
+void nb_ndarray_exports_clear(nb_ndarray_export_map &exports) noexcept {
+    for (auto &kv : exports)
+        Py_DECREF(kv.second.weakref);
+    exports.clear();
+}
+
+/// Check that the buffer of a cached export still matches its key
+static bool ndarray_export_valid(PyObject *o,
+                                 const nb_ndarray_export_key &key) noexcept {
+    Py_buffer view;
+    if (PyObject_GetBuffer(o, &view, PyBUF_RECORDS_RO)) {
+        PyErr_Clear();
+        return false;
+    }
+
+    dlpack::dtype dt;
+    bool valid = buffer_dtype(&view, dt) &&
+                 ((uint32_t) dt.code | (uint32_t) dt.bits << 8 |
+                  (uint32_t) dt.lanes << 16) == key.dtype &&
+                 view.buf == (uint8_t *) key.data + key.byte_offset &&
+                 view.ndim == key.ndim && (uint32_t) view.readonly == key.ro;
+
+    // Keys store strides in elements (or zero for C-contiguous arrays)
+    int64_t stride = view.itemsize;
+    for (int32_t i = key.ndim - 1; valid && i >= 0; --i) {
+        int64_t expected = key.strides[i] * view.itemsize;
+        if (expected == 0 && key.shape[i] > 1)
+            expected = stride;
+        valid = view.shape[i] == key.shape[i] &&
+                (key.shape[i] <= 1 || view.strides[i] == expected);
+        stride *= key.shape[i];
+    }
+
+    PyBuffer_Release(&view);
+    return valid;
+}
+
+static PyObject *ndarray_export_cached(nb_internals *p, ndarray_handle *th,
+                                       int framework) noexcept {
+    const dlpack::dltensor &t = th->tensor();
+    if (t.ndim > 4 || t.device.device_type != device::cpu::value ||
+        (framework != numpy::value && framework != memview::value &&
+         framework != array_api::value))
+        return ndarray_export_new(p, th, framework, false);
+
+    nb_ndarray_export_key key;
+    memset(&key, 0, sizeof(key));
+    key.data = t.data;
+    key.owner = th->owner;
+    key.byte_offset = t.byte_offset;
+    for (int32_t i = 0; i < t.ndim; ++i) {
+        key.shape[i] = t.shape[i];
+        key.strides[i] = t.strides ? t.strides[i] : 0;
+    }
+    key.ndim = t.ndim;
+    key.device_type = t.device.device_type;
+    key.device_id = t.device.device_id;
+    key.dtype = (uint32_t) t.dtype.code | (uint32_t) t.dtype.bits << 8 |
+                (uint32_t) t.dtype.lanes << 16;
+    key.framework = framework;
+    key.ro = th->ro;
+
+    // FNV-1a hash of the key
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const uint8_t *bytes = (const uint8_t *) &key;
+    for (size_t i = 0; i < sizeof(key); ++i)
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+
+    nb_ndarray_export_map &exports = ndarray_exports(p);
+    nb_ndarray_export_map::iterator it = exports.find(hash);
+    if (it != exports.end() &&
+        memcmp(&it->second.key, &key, sizeof(key)) == 0) {
+        PyObject *o = nullptr;
+#if PY_VERSION_HEX >= 0x030D0000
+        if (PyWeakref_GetRef(it->second.weakref, &o) < 0)
+            PyErr_Clear();
+#else
+        o = PyWeakref_GetObject(it->second.weakref);
+        o = o == Py_None ? nullptr : Py_NewRef(o);
+#endif
+        if (o) {
+            if (ndarray_export_valid(o, key))
+                return o;
+            Py_DECREF(o);
+        }
+    }
+
+    PyObject *o = ndarray_export_new(p, th, framework, false);
+    if (!o)
+        return nullptr;
+
+    PyObject *weakref = PyWeakref_NewRef(o, nullptr);
+    if (!weakref) {
+        PyErr_Clear();
+        return o;
+    }
+
+    // Exporting may have run Python code that changed the cache
+    it = exports.find(hash);
+    if (it != exports.end()) {
+        Py_DECREF(it->second.weakref);
+        it.value() = { key, weakref };
+    } else {
+        if (exports.size() >= 1024)
+            nb_ndarray_exports_clear(exports);
+        exports.emplace(hash, nb_ndarray_export_entry{ key, weakref });
+    }
+
+    return o;
+}
+
+// ========================================================================
+
+/// Is the integer 'value' representable by the type 'Out'?
+template <typename Out, typename In> NB_INLINE bool int_fits(In value) {
+    Out result = (Out) value;
+    if constexpr (std::is_signed_v<In> && !std::is_signed_v<Out>) {
+        if (value < 0)
+            return false;
+    } else if constexpr (!std::is_signed_v<In> && std::is_signed_v<Out>) {
+        if (result < 0)
+            return false;
+    }
+    return (In) result == value;
+}
+
+/// Convert 'n' buffer elements of type 'In' spaced 'stride' bytes apart
+template <typename Out, typename In>
+static bool buffer_convert(const uint8_t *src, Py_ssize_t stride, size_t n,
+                           Out *out) noexcept {
+    if constexpr (std::is_same_v<In, Out>) {
+        if (stride == (Py_ssize_t) sizeof(In)) {
+            memcpy(out, src, n * sizeof(Out));
+            return true;
+        }
+    }
+
+    if constexpr (std::is_integral_v<Out> && !std::is_same_v<In, bool>) {
+        if constexpr (std::is_floating_point_v<In>) {
+            return false;
+        } else {
+            // Like the scalar casters, reject values that are out of range
+            for (size_t i = 0; i < n; ++i) {
+                In value;
+                memcpy(&value, src + (Py_ssize_t) i * stride, sizeof(In));
+                if (!int_fits<Out>(value))
+                    return false;
+                out[i] = (Out) value;
+            }
+            return true;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            In value;
+            memcpy(&value, src + (Py_ssize_t) i * stride, sizeof(In));
+            out[i] = (Out) value;
+        }
+        return true;
+    }
+}
+
+template <typename Out>
+static bool buffer_convert(const uint8_t *src, Py_ssize_t stride, size_t n,
+                           dlpack::dtype dt, Out *out) noexcept {
+    switch (dt.code) {
+        case (uint8_t) dlpack::dtype_code::Int:
+            switch (dt.bits) {
+                case 8:  return buffer_convert<Out, int8_t>(src, stride, n, out);
+                case 16: return buffer_convert<Out, int16_t>(src, stride, n, out);
+                case 32: return buffer_convert<Out, int32_t>(src, stride, n, out);
+                case 64: return buffer_convert<Out, int64_t>(src, stride, n, out);
+                default: return false;
+            }
+
+        case (uint8_t) dlpack::dtype_code::UInt:
+            switch (dt.bits) {
+                case 8:  return buffer_convert<Out, uint8_t>(src, stride, n, out);
+                case 16: return buffer_convert<Out, uint16_t>(src, stride, n, out);
+                case 32: return buffer_convert<Out, uint32_t>(src, stride, n, out);
+                case 64: return buffer_convert<Out, uint64_t>(src, stride, n, out);
+                default: return false;
+            }
+
+        case (uint8_t) dlpack::dtype_code::Float:
+            switch (dt.bits) {
+                case 32: return buffer_convert<Out, float>(src, stride, n, out);
+                case 64: return buffer_convert<Out, double>(src, stride, n, out);
+                default: return false;
+            }
+
+        case (uint8_t) dlpack::dtype_code::Bool:
+            if (dt.bits != 8)
+                return false;
+            return buffer_convert<Out, bool>(src, stride, n, out);
+
+        default:
+            return false;
+    }
+}
+
+bool load_buffer(nb_internals *, PyObject *o, char kind, size_t size,
+                 uint32_t flags, void *(*resize)(void *, size_t) noexcept,
+                 void *target) noexcept {
+    // Without implicit conversions, the elements of many buffers (e.g., NumPy
+    // scalars) are rejected by the scalar casters. Let them decide.
+    if (!(flags & cast_flags::convert))
+        return false;
+
+    if (kind == 'f' ? (size != sizeof(float) && size != sizeof(double))
+                    : (size != 1 && size != 2 && size != 4 && size != 8))
+        return false;
+
+    // 'bytes' is not treated as a sequence of integers
+    PyTypeObject *tp = Py_TYPE(o);
+    if (tp == &PyBytes_Type || !obj_has_buffer(o, tp))
+        return false;
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(o, &view, PyBUF_RECORDS_RO)) {
+        PyErr_Clear();
+        return false;
+    }
+
+    dlpack::dtype dt;
+    bool success = view.ndim == 1 && buffer_dtype(&view, dt);
+
+    if (success) {
+        size_t n = (size_t) view.shape[0];
+        void *out = resize(target, n);
+        const uint8_t *src = (const uint8_t *) view.buf;
+        Py_ssize_t stride = view.strides[0];
+
+        bool is_signed = kind == 'i';
+
+        if (!out || n == 0)
+            success = out != nullptr;
+        else if (kind == 'f')
+            success = size == sizeof(double)
+                ? buffer_convert(src, stride, n, dt, (double *) out)
+                : buffer_convert(src, stride, n, dt, (float *) out);
+        else if (size == 1)
+            success = is_signed ? buffer_convert(src, stride, n, dt, (int8_t *) out)
+                                : buffer_convert(src, stride, n, dt, (uint8_t *) out);
+        else if (size == 2)
+            success = is_signed ? buffer_convert(src, stride, n, dt, (int16_t *) out)
+                                : buffer_convert(src, stride, n, dt, (uint16_t *) out);
+        else if (size == 4)
+            success = is_signed ? buffer_convert(src, stride, n, dt, (int32_t *) out)
+                                : buffer_convert(src, stride, n, dt, (uint32_t *) out);
+        else
+            success = is_signed ? buffer_convert(src, stride, n, dt, (int64_t *) out)
+                                : buffer_convert(src, stride, n, dt, (uint64_t *) out);
+    }
+
+    PyBuffer_Release(&view);
+    return success;
+}
+
+// ========================================================================
+
+/// Mapped file region, owned by the capsule returned from ndarray_mmap()
+struct nd_mapping {
+    void *base;
+    size_t size;
+};
+
+static void nd_mapping_delete(PyObject *o) noexcept {
+    nd_mapping *m = (nd_mapping *) PyCapsule_GetPointer(o, "nd_mapping");
+    if (!m) {
+        PyErr_Clear();
+        return;
+    }
+    if (m->base) {
+#if defined(_WIN32)
+        UnmapViewOfFile(m->base);
+#else
+        munmap(m->base, m->size);
+#endif
+    }
+    PyMem_Free(m);
+}
+
+PyObject *ndarray_mmap(const char *path, int fd, uint64_t offset, size_t size,
+                       uint32_t mode, void **data) noexcept {
+    mmap_mode mm = (mmap_mode) mode;
+    bool writable = mm == mmap_mode::read_write;
+
+    if (mm != mmap_mode::read_only && mm != mmap_mode::read_write &&
+        mm != mmap_mode::copy_on_write) {
+        PyErr_SetString(PyExc_ValueError,
+                        "nanobind::ndarray_mmap(): invalid mode!");
+        return nullptr;
+    }
+
+    nd_mapping *m = (nd_mapping *) PyMem_Malloc(sizeof(nd_mapping));
+    if (!m)
+        return PyErr_NoMemory();
+    m->base = nullptr;
+    m->size = 0;
+
+    // Map at least one byte, so that empty arrays have a valid address
+    uint64_t length = std::max(size, (size_t) 1);
+    bool success = false;
+    const char *reason = nullptr;
+
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    uint64_t start = offset - offset % info.dwAllocationGranularity;
+
+    HANDLE file;
+    if (path)
+        file = CreateFileA(path, GENERIC_READ | (writable ? GENERIC_WRITE : 0),
+                           FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    else
+        file = (HANDLE) _get_osfhandle(fd);
+
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size)) {
+        PyErr_SetFromWindowsErr(0);
+    } else if (offset > UINT64_MAX - length ||
+               offset - start > SIZE_MAX - length) {
+        reason = "the mapped range exceeds the address space";
+    } else if ((uint64_t) file_size.QuadPart < offset + size) {
+        reason = "the file is too small";
+    } else {
+        DWORD protect = mm == mmap_mode::read_only    ? PAGE_READONLY
+                        : mm == mmap_mode::read_write ? PAGE_READWRITE
+                                                      : PAGE_WRITECOPY;
+        DWORD access = mm == mmap_mode::read_only    ? FILE_MAP_READ
+                       : mm == mmap_mode::read_write ? FILE_MAP_WRITE
+                                                     : FILE_MAP_COPY;
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, protect, 0, 0,
+                                            nullptr);
+        if (mapping) {
+            m->size = (size_t) (offset - start + length);
+            m->base = MapViewOfFile(mapping, access, (DWORD) (start >> 32),
+                                    (DWORD) start, m->size);
+            CloseHandle(mapping);
+        }
+        if (m->base)
+            success = true;
+        else
+            PyErr_SetFromWindowsErr(0);
+    }
+
+    if (path && file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+#else
+    uint64_t page = (uint64_t) sysconf(_SC_PAGESIZE),
+             start = offset - offset % page;
+
+    if (path)
+        fd = open(path, writable ? O_RDWR : O_RDONLY);
+
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+    } else if (offset > UINT64_MAX - length ||
+               offset - start > SIZE_MAX - length) {
+        reason = "the mapped range exceeds the address space";
+    } else if ((uint64_t) st.st_size < offset + size) {
+        reason = "the file is too small";
+    } else {
+        int prot = PROT_READ | (mm == mmap_mode::read_only ? 0 : PROT_WRITE),
+            flags = mm == mmap_mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+        m->size = (size_t) (offset - start + length);
+        void *base = mmap(nullptr, m->size, prot, flags, fd, (off_t) start);
+        if (base != MAP_FAILED) {
+            m->base = base;
+            success = true;
+        } else {
+            PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+        }
+    }
+
+    if (path && fd >= 0)
+        close(fd);
+#endif
+
+    if (reason)
+        PyErr_Format(PyExc_ValueError, "nanobind::ndarray_mmap(): %s!",
+                     reason);
+
+    PyObject *capsule = nullptr;
+    if (success)
+        capsule = PyCapsule_New(m, "nd_mapping", nd_mapping_delete);
+
+    if (!capsule) {
+        if (m->base) {
+#if defined(_WIN32)
+            UnmapViewOfFile(m->base);
+#else
+            munmap(m->base, m->size);
+#endif
+        }
+        PyMem_Free(m);
+        return nullptr;
+    }
+
+    *data = (uint8_t *) m->base + (offset - start);
+    return capsule;
+}
+
+// ========================================================================
+
+/* Storage allocated by ndarray_alloc(). The block header is placed *after*
+   the data (at the end of the allocation), so that large alignments don't
+   waste a full alignment unit in front of the array. Blocks of up to 16 MiB
+   with the default alignment are rounded up to a power of two and recycled
+   through per-thread free lists ('nb_ndarray_alloc_pool'). */
+struct nd_alloc_header {
+    nb_internals *internals;
+    void *base;
+    size_t size;
+    uint8_t size_class;
+};
+
+/// Size classes used by the free lists (4 KiB .. 16 MiB)
+static constexpr uint32_t nd_alloc_min_class = 12, nd_alloc_classes = 13;
+
+/// Blocks with at most this alignment can be recycled
+static constexpr size_t nd_alloc_pool_alignment = 64;
+
+/// Bytes and blocks (per size class) that the free lists may hold
+static constexpr size_t nd_alloc_pool_bytes = (size_t) 64 << 20;
+static constexpr uint32_t nd_alloc_pool_limit = 4;
+
+/// Size and alignment of huge pages (only used on Linux)
+static constexpr size_t nd_huge_page = (size_t) 2 << 20;
+
+static nb_ndarray_alloc_pool &ndarray_alloc_pool(nb_internals *p) noexcept {
+#if defined(NB_FREE_THREADED)
+    return nb_thread_state_get(p)->ndarray_alloc_pool;
+#else
+    return p->ndarray_alloc_pool;
+#endif
+}
+
+static void *nd_aligned_malloc(size_t size, size_t alignment) noexcept {
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0)
+        return nullptr;
+    return ptr;
+#endif
+}
+
+static void nd_aligned_free(void *ptr) noexcept {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static nd_alloc_header *nd_alloc_header_get(void *base, size_t size) noexcept {
+    size_t offset = (size + alignof(nd_alloc_header) - 1) &
+                    ~(alignof(nd_alloc_header) - 1);
+    return (nd_alloc_header *) ((uint8_t *) base + offset);
+}
+
+static void nd_alloc_delete(PyObject *o) noexcept {
+    nd_alloc_header *h = (nd_alloc_header *) PyCapsule_GetContext(o);
+    if (!h) {
+        PyErr_Clear();
+        return;
+    }
+
+    uint8_t size_class = h->size_class;
+    if (size_class < nd_alloc_classes) {
+        nb_ndarray_alloc_pool &pool = ndarray_alloc_pool(h->internals);
+        size_t size = h->size;
+        if (pool.count[size_class] < nd_alloc_pool_limit &&
+            pool.bytes + size <= nd_alloc_pool_bytes) {
+            *(void **) h->base = pool.head[size_class];
+            pool.head[size_class] = h->base;
+            pool.count[size_class]++;
+            pool.bytes += size;
+            return;
+        }
+    }
+
+    nd_aligned_free(h->base);
+}
+
+void nb_ndarray_alloc_pool_drain(nb_ndarray_alloc_pool *pool) noexcept {
+    for (uint32_t i = 0; i < nd_alloc_classes; ++i) {
+        void *block = pool->head[i];
+        while (block) {
+            void *next = *(void **) block;
+            nd_aligned_free(block);
+            block = next;
+        }
+        pool->head[i] = nullptr;
+        pool->count[i] = 0;
+    }
+    pool->bytes = 0;
+}
+
+PyObject *ndarray_alloc(nb_internals *p, size_t size, size_t alignment,
+                        uint32_t flags, void **data) noexcept {
+    if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "nanobind::ndarray_alloc(): the alignment must be a "
+                        "power of two and at least the size of a pointer!");
+        return nullptr;
+    }
+
+    bool huge = (flags & (uint32_t) alloc_flags::huge_pages) &&
+                size >= nd_huge_page;
+    if (huge && alignment < nd_huge_page)
+        alignment = nd_huge_page;
+
+    // Leave room for the header and for rounding up to whole huge pages
+    size_t extra = alignof(nd_alloc_header) + sizeof(nd_alloc_header);
+    if (size > SIZE_MAX - extra - nd_huge_page)
+        return PyErr_NoMemory();
+    size_t total = size + extra;
+
+    // Round small blocks up to a size class, so that they can be recycled
+    uint8_t size_class = 0xFF;
+    if (alignment <= nd_alloc_pool_alignment && !huge) {
+        uint32_t c = nd_alloc_min_class;
+        while (c < nd_alloc_min_class + nd_alloc_classes &&
+               ((size_t) 1 << c) < total)
+            ++c;
+        if (c < nd_alloc_min_class + nd_alloc_classes) {
+            size_class = (uint8_t) (c - nd_alloc_min_class);
+            total = (size_t) 1 << c;
+            alignment = nd_alloc_pool_alignment;
+        }
+    }
+
+    void *base = nullptr;
+    if (size_class != 0xFF) {
+        nb_ndarray_alloc_pool &pool = ndarray_alloc_pool(p);
+        base = pool.head[size_class];
+        if (base) {
+            pool.head[size_class] = *(void **) base;
+            pool.count[size_class]--;
+            pool.bytes -= total;
+        }
+    }
+
+    if (!base) {
+        if (huge)
+            total = (total + nd_huge_page - 1) & ~(nd_huge_page - 1);
+
+        base = nd_aligned_malloc(total, alignment);
+        if (!base)
+            return PyErr_NoMemory();
+
+#if defined(MADV_HUGEPAGE)
+        // Only a hint: the kernel may not support transparent huge pages
+        if (huge)
+            (void) madvise(base, total, MADV_HUGEPAGE);
+#endif
+    }
+
+    nd_alloc_header *h = nd_alloc_header_get(base, size);
+    h->internals = p;
+    h->base = base;
+    h->size = total;
+    h->size_class = size_class;
+
+    PyObject *capsule = PyCapsule_New(base, "nd_alloc", nullptr);
+    if (!capsule || PyCapsule_SetContext(capsule, h) != 0 ||
+        PyCapsule_SetDestructor(capsule, nd_alloc_delete) != 0) {
+        Py_XDECREF(capsule);
+        nd_aligned_free(base);
+        return nullptr;
+    }
+
+    *data = base;
+    return capsule;
+}
+
 NAMESPACE_END(detail)
 NAMESPACE_END(NB_NAMESPACE)
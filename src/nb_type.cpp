@@ -9,6 +9,7 @@
 
 #include "nb_internals.h"
 #include "nb_ft.h"
+#include <atomic>
 
 
 #if defined(_MSC_VER)
@@ -102,51 +103,45 @@ static NB_INLINE bool nb_type_ensure(PyTypeObject *tp) {
            nb_type_init_py(tp) == 0;
 }
 
-/// Allocate memory for a nb_type instance with internal storage
-PyObject *inst_new_int(PyTypeObject *tp, PyObject * /* args */,
-                       PyObject * /*kwd */) {
-    const type_data *t = nb_type_data(tp);
-    if (NB_UNLIKELY(!nb_type_ensure(tp)))
-        return nullptr;
-    uint32_t flags = t->flags;
+/// Revive an instance taken from the pool of 'tp'. Pooled objects remain
+/// registered in 'inst_c2p', so only the object header needs to be restored.
+static NB_INLINE void inst_revive(PyTypeObject *tp, uint32_t flags,
+                                  nb_inst *self) noexcept {
+    // Resurrect the dead object with a single reference.
+    nb_resurrect((PyObject *) self);
 
-    // Instance pool fast path
-    if (NB_LIKELY(flags & (uint32_t) type_flags::pooled)) {
-        nb_inst_pool *pool = nb_pool_lookup((type_data *) t);
-        if (pool && pool->count) {
-            nb_inst *self = pool->slots[--pool->count];
+    // Overwrite the status word in full. Pooled types are always
+    // co-located, internal-storage, non-intrusive.
+    nb_inst_state s {};
+    s.state = nb_inst_state::state_uninitialized;
+    s.direct = 1;
+    s.internal = 1;
+    s.destruct = 0;
+    s.cpp_delete = 0;
+    s.intrusive = 0;
+    s.compact = (flags & (uint32_t) type_flags_internal::is_compact) != 0;
+    s.clear_keep_alive = 0;
+    s.keep_alive_slot = 0;
+    s.unused = 0;
+    nb_inst_state_write(self, s);
 
-            // Resurrect the dead object with a single reference.
-            nb_resurrect((PyObject *) self);
-
-            // Overwrite the status word in full. Pooled types are always
-            // co-located, internal-storage, non-intrusive.
-            nb_inst_state s {};
-            s.state = nb_inst_state::state_uninitialized;
-            s.direct = 1;
-            s.internal = 1;
-            s.destruct = 0;
-            s.cpp_delete = 0;
-            s.intrusive = 0;
-            s.pad = 0;
-            s.clear_keep_alive = 0;
-            s.unused = 0;
-            nb_inst_state_write(self, s);
-
-            // Re-enable try_inc_ref for this object.
-            nb_enable_try_inc_ref((PyObject *) self);
-
-            // The revived object must hold a reference to its type object
-            NB_INCREF_TYPE((PyObject *) tp);
-
-            // Re-track GC instances
-            if (NB_UNLIKELY(nb_type_has_gc(tp, flags)))
-                PyObject_GC_Track((PyObject *) self);
+    // Re-enable try_inc_ref for this object.
+    nb_enable_try_inc_ref((PyObject *) self);
 
-            return (PyObject *) self;
-        }
-    }
+    // The revived object must hold a reference to its type object
+    NB_INCREF_TYPE((PyObject *) tp);
 
+    // Re-track GC instances
+    if (NB_UNLIKELY(nb_type_has_gc(tp, flags)))
+        PyObject_GC_Track((PyObject *) self);
+}
+
+/// Allocate a new instance with internal storage. In contrast to
+/// 'inst_new_int()', this does not consult the instance pool or register the
+/// instance in 'inst_c2p'.
+static NB_INLINE nb_inst *inst_alloc_int(PyTypeObject *tp,
+                                         const type_data *t) noexcept {
+    uint32_t flags = t->flags;
     bool gc = nb_type_has_gc(tp, flags);
 
     nb_inst *self;
@@ -157,14 +152,18 @@ PyObject *inst_new_int(PyTypeObject *tp, PyObject * /* args */,
 
     if (NB_LIKELY(self)) {
         uint32_t align = t->align;
-        bool intrusive = flags & (uint32_t) type_flags::intrusive_ptr;
+        bool intrusive = flags & (uint32_t) type_flags::intrusive_ptr,
+             compact = flags & (uint32_t) type_flags_internal::is_compact;
 
-        uintptr_t payload = (uintptr_t) (self + 1);
+        // Compact instances store their data in the 'offset' field
+        if (!compact) {
+            uintptr_t payload = (uintptr_t) (self + 1);
 
-        if (NB_UNLIKELY(align > sizeof(void *)))
-            payload = (payload + align - 1) & ~(uintptr_t(align) - 1);
+            if (NB_UNLIKELY(align > sizeof(void *)))
+                payload = (payload + align - 1) & ~(uintptr_t(align) - 1);
 
-        self->offset = (int32_t) ((intptr_t) payload - (intptr_t) self);
+            self->offset = (int32_t) ((intptr_t) payload - (intptr_t) self);
+        }
 
         nb_inst_state s {};
         s.direct = 1;
@@ -174,17 +173,49 @@ PyObject *inst_new_int(PyTypeObject *tp, PyObject * /* args */,
         s.cpp_delete = 0;
         s.clear_keep_alive = 0;
         s.intrusive = intrusive;
-        s.pad = 0;
+        s.compact = compact;
+        s.keep_alive_slot = 0;
         s.unused = 0;
         nb_inst_state_write(self, s);
 
         // Make the object compatible with nb_try_inc_ref (free-threaded builds only)
         nb_enable_try_inc_ref((PyObject *) self);
+    }
+
+    return self;
+}
 
+/// Allocate memory for a nb_type instance with internal storage
+PyObject *inst_new_int(PyTypeObject *tp, PyObject * /* args */,
+                       PyObject * /*kwd */) {
+    const type_data *t = nb_type_data(tp);
+    if (NB_UNLIKELY(!nb_type_ensure(tp)))
+        return nullptr;
+    uint32_t flags = t->flags;
+
+    // Instance pool fast path
+    if (NB_LIKELY(flags & (uint32_t) type_flags::pooled)) {
+        nb_inst_pool *pool = nb_pool_lookup((type_data *) t);
+        if (pool && pool->count) {
+            nb_inst *self = pool->slots[--pool->count];
+            pool->hits++;
+            nb_pool_tick((type_data *) t, pool);
+            inst_revive(tp, flags, self);
+            return (PyObject *) self;
+        } else if (pool && pool->slots) {
+            pool->misses++;
+            nb_pool_tick((type_data *) t, pool);
+        }
+    }
+
+    nb_inst *self = inst_alloc_int(tp, t);
+
+    if (NB_LIKELY(self && !(flags & (uint32_t) type_flags::no_identity))) {
         // Update hash table that maps from C++ to Python instance
-        nb_shard &shard = t->internals->shard((void *) payload);
+        void *payload = inst_ptr(self);
+        nb_shard &shard = t->internals->shard(payload);
         lock_shard guard(shard);
-        auto [it, success] = shard.inst_c2p.try_emplace((void *) payload, self);
+        auto [it, success] = shard.inst_c2p.try_emplace(payload, self);
         check(success, "nanobind::detail::inst_new_int(): unexpected collision!");
     }
 
@@ -201,7 +232,10 @@ PyObject *inst_new_ext(PyTypeObject *tp, void *value) {
 
     nb_inst *self;
     if (NB_LIKELY(!gc)) {
-        self = (nb_inst *) PyObject_Malloc(sizeof(nb_inst));
+        // Reserve the word used by a far data pointer or an inline keep-alive
+        // reference (see nb_inst_keep_alive_slot()). Given the 16-byte size
+        // classes of pymalloc, this usually does not enlarge the allocation.
+        self = (nb_inst *) PyObject_Malloc(sizeof(nb_inst) + sizeof(void *));
         if (!self)
             return PyErr_NoMemory();
         PyObject_Init((PyObject *) self, tp);
@@ -220,20 +254,6 @@ PyObject *inst_new_ext(PyTypeObject *tp, void *value) {
     bool direct = (intptr_t) self + offset == (intptr_t) value;
     if (NB_UNLIKELY(!direct)) {
         // Location is not representable as signed 32 bit offset
-        if (!gc) {
-            /// Allocate memory for an extra pointer
-            nb_inst *self_2 =
-                (nb_inst *) PyObject_Realloc(self, sizeof(nb_inst) + sizeof(void *));
-
-            if (NB_UNLIKELY(!self_2)) {
-                NB_DECREF_TYPE(tp);
-                PyObject_Free(self);
-                return PyErr_NoMemory();
-            }
-
-            self = self_2;
-        }
-
         *(void **) (self + 1) = value;
         offset = (int32_t) sizeof(nb_inst);
     }
@@ -250,10 +270,14 @@ PyObject *inst_new_ext(PyTypeObject *tp, void *value) {
     s.cpp_delete = 0;
     s.clear_keep_alive = 0;
     s.intrusive = intrusive;
-    s.pad = 0;
+    s.compact = 0;
+    s.keep_alive_slot = !gc && direct;
     s.unused = 0;
     nb_inst_state_write(self, s);
 
+    if (s.keep_alive_slot)
+        nb_inst_keep_alive_slot(self) = nullptr;
+
     // Make the object compatible with nb_try_inc_ref (free-threaded builds only)
     nb_enable_try_inc_ref((PyObject *) self);
 
@@ -263,6 +287,8 @@ PyObject *inst_new_ext(PyTypeObject *tp, void *value) {
 /// Register the object constructed by 'inst_new_ext()' in the internal data structures
 static void inst_register(nb_internals *p, PyObject *inst,
                           void *value) noexcept {
+    // This includes instances of 'no_identity' types, so that a pointer
+    // returned twice doesn't end up with two owners
     nb_shard &shard = p->shard(value);
     lock_shard guard(shard);
 
@@ -334,6 +360,7 @@ nb_inst_pool *nb_pool_ensure(type_data *td) noexcept {
     if (NB_UNLIKELY(!pool->slots)) {
         pool->capacity = td->pool_capacity;
         pool->count = 0;
+        pool->idle_mark = UINT32_MAX;
         pool->slots = (nb_inst **) PyMem_Malloc(pool->capacity * sizeof(nb_inst *));
         check(pool->slots, "nb_pool_ensure(): out of memory!");
     }
@@ -341,54 +368,53 @@ nb_inst_pool *nb_pool_ensure(type_data *td) noexcept {
     return pool;
 }
 
-// Unmap all parked instances of a pool from 'inst_c2p' and release them. When
-// called after interpreter shutdown it is no longer safe to release memory via
-// PyMem_Free/PyObject_Free and can_free=false must be specified.
-void nb_pool_drain(nb_inst_pool *pool, bool can_free) noexcept {
-    if (!pool || !pool->slots)
+/// Unmap the parked instances 'slots[begin..end)' of a pool from 'inst_c2p'
+/// and release them (see nb_pool_drain() regarding 'can_free')
+static void nb_pool_release(nb_inst_pool *pool, uint32_t begin, uint32_t end,
+                            bool can_free) noexcept {
+    if (begin == end)
         return;
 
     // Check the type-level properties of the pooled instances once
-    bool gc = false;
-    nb_internals *pi = nullptr;
-    if (pool->count) {
-        PyTypeObject *tp = Py_TYPE((PyObject *) pool->slots[0]);
-        pi = nb_type_data(tp)->internals;
-        if (can_free)
-            gc = nb_type_has_gc(tp, nb_type_data(tp)->flags);
-    }
+    PyTypeObject *tp = Py_TYPE((PyObject *) pool->slots[begin]);
+    uint32_t flags = nb_type_data(tp)->flags;
+    nb_internals *pi = nb_type_data(tp)->internals;
+    bool identity = !(flags & (uint32_t) type_flags::no_identity),
+         gc = can_free && nb_type_has_gc(tp, flags);
 
-    for (uint32_t i = 0; i < pool->count; ++i) {
+    for (uint32_t i = begin; i < end; ++i) {
         nb_inst *inst = pool->slots[i];
         void *p = inst_ptr(inst);
 
-        nb_shard &shard = pi->shard(p);
-        lock_shard guard(shard);
-
-        // Unmap 'inst' from inst_c2p
-        nb_ptr_map &inst_c2p = shard.inst_c2p;
-        nb_ptr_map::iterator it = inst_c2p.find(p);
-        if (NB_LIKELY(it != inst_c2p.end())) {
-            void *entry = it->second;
-            if (NB_LIKELY(entry == inst)) {
-                inst_c2p.erase_fast(it);
-            } else if (nb_is_seq(entry)) {
-                nb_inst_seq *seq = nb_get_seq(entry), *pred = nullptr;
-                do {
-                    if ((nb_inst *) seq->inst == inst) {
-                        if (pred)
-                            pred->next = seq->next;
-                        else if (seq->next)
-                            it.value() = nb_mark_seq(seq->next);
-                        else
-                            inst_c2p.erase_fast(it);
-                        if (can_free)
-                            PyMem_Free(seq);
-                        break;
-                    }
-                    pred = seq;
-                    seq = seq->next;
-                } while (seq);
+        if (identity) {
+            nb_shard &shard = pi->shard(p);
+            lock_shard guard(shard);
+
+            // Unmap 'inst' from inst_c2p
+            nb_inst_map &inst_c2p = shard.inst_c2p;
+            nb_inst_map::iterator it = inst_c2p.find(p);
+            if (NB_LIKELY(it != inst_c2p.end())) {
+                void *entry = it->second;
+                if (NB_LIKELY(entry == inst)) {
+                    inst_c2p.erase_fast(it);
+                } else if (nb_is_seq(entry)) {
+                    nb_inst_seq *seq = nb_get_seq(entry), *pred = nullptr;
+                    do {
+                        if ((nb_inst *) seq->inst == inst) {
+                            if (pred)
+                                pred->next = seq->next;
+                            else if (seq->next)
+                                it.value() = nb_mark_seq(seq->next);
+                            else
+                                inst_c2p.erase_fast(it);
+                            if (can_free)
+                                PyMem_Free(seq);
+                            break;
+                        }
+                        pred = seq;
+                        seq = seq->next;
+                    } while (seq);
+                }
             }
         }
 
@@ -399,12 +425,151 @@ void nb_pool_drain(nb_inst_pool *pool, bool can_free) noexcept {
                 PyObject_Free(inst);
         }
     }
+}
+
+// Unmap all parked instances of a pool from 'inst_c2p' and release them. When
+// called after interpreter shutdown it is no longer safe to release memory via
+// PyMem_Free/PyObject_Free and can_free=false must be specified.
+void nb_pool_drain(nb_inst_pool *pool, bool can_free) noexcept {
+    if (!pool || !pool->slots)
+        return;
+
+    nb_pool_release(pool, 0, pool->count, can_free);
 
     if (can_free)
         PyMem_Free(pool->slots);
-    pool->slots = nullptr;
-    pool->count = 0;
-    pool->capacity = 0;
+    *pool = nb_inst_pool{};
+}
+
+/// Add 'value' to a pool statistics counter
+static void nb_pool_stat_add(uint64_t &counter, uint64_t value) noexcept {
+#if defined(NB_FREE_THREADED)
+    ((std::atomic<uint64_t> *) &counter)->fetch_add(value, std::memory_order_relaxed);
+#else
+    counter += value;
+#endif
+}
+
+/// Bounds of the adaptive capacity of the pool of 'td'
+static uint32_t nb_pool_min_capacity(const type_data *td) noexcept {
+    return td->pool_capacity / 8 ? td->pool_capacity / 8 : 1;
+}
+
+static uint32_t nb_pool_max_capacity(const type_data *td) noexcept {
+    uint64_t value = (uint64_t) td->pool_capacity * 8;
+    return value < 65536 ? (uint32_t) value : 65536;
+}
+
+/// Resize the slot array of a pool. Keeps the old array if this fails.
+static bool nb_pool_resize(nb_inst_pool *pool, uint32_t capacity) noexcept {
+    nb_inst **slots = (nb_inst **) PyMem_Realloc(
+        pool->slots, (size_t) capacity * sizeof(nb_inst *));
+    if (!slots)
+        return false;
+    pool->slots = slots;
+    pool->capacity = capacity;
+    return true;
+}
+
+/// Halve the capacity of a pool, releasing the instances that have been
+/// parked the longest
+static void nb_pool_shrink(type_data *td, nb_inst_pool *pool) noexcept {
+    nb_pool_stats &stats = td->pool_stats;
+    uint32_t new_capacity = pool->capacity / 2;
+    if (new_capacity < nb_pool_min_capacity(td))
+        new_capacity = nb_pool_min_capacity(td);
+
+    if (pool->count > new_capacity) {
+        uint32_t n = pool->count - new_capacity;
+        nb_pool_release(pool, 0, n, true);
+        memmove(pool->slots, pool->slots + n,
+                new_capacity * sizeof(nb_inst *));
+        pool->count = new_capacity;
+        nb_pool_stat_add(stats.evictions, n);
+    }
+
+    // Shrinking the slot array in place cannot fail in practice. If it does,
+    // the old array remains valid for the lower capacity.
+    nb_pool_resize(pool, new_capacity);
+    pool->capacity = new_capacity;
+    nb_pool_stat_add(stats.shrinks, 1);
+}
+
+/// Number of observation windows (of any pool) between two idle sweeps
+static constexpr uint32_t nb_pool_sweep_interval = 4;
+
+/* Observation windows are counted in the events of a pool, so a pool that is
+   no longer used would never reach the end of one. Every few windows of any
+   pool of the domain (or, in free-threaded builds, of the calling thread),
+   this function therefore visits all other pools and halves those that saw
+   no events since the previous sweep. */
+static void nb_pool_sweep(nb_internals *p) noexcept {
+    auto visit = [](type_data *td, nb_inst_pool *pool) {
+        if (pool->idle_mark == pool->events &&
+            pool->capacity > nb_pool_min_capacity(td))
+            nb_pool_shrink(td, pool);
+        pool->idle_mark = pool->events;
+    };
+
+#if defined(NB_FREE_THREADED)
+    // Per-thread pools can only be attributed to their type via the parked
+    // instances. Empty pools hold no instances worth releasing.
+    nb_thread_state *ts = nb_thread_state_get(p);
+    for (uint32_t i = 0; i < ts->pools_size; ++i) {
+        nb_inst_pool *pool = &ts->pools[i];
+        if (pool->count)
+            visit(nb_type_data(Py_TYPE((PyObject *) pool->slots[0])), pool);
+    }
+#else
+    for (const auto &kv : p->type_c2p_slow) {
+        type_data *td = kv.second;
+        if ((td->flags & (uint32_t) type_flags::pooled) && td->pool.slots)
+            visit(td, &td->pool);
+    }
+#endif
+}
+
+/* Called at the end of each observation window of a pool to publish its
+   counters and adapt its capacity. The pool grows when allocations miss while
+   a significant fraction of the released instances had to be freed because
+   the pool was full (a larger pool would have served them). It shrinks
+   when at least half of its capacity held parked instances that were not
+   needed during the entire window, releasing the oldest of them. Pools that
+   see no events at all are trimmed by nb_pool_sweep(). */
+NB_NOINLINE void nb_pool_adapt(type_data *td, nb_inst_pool *pool) noexcept {
+    nb_pool_stats &stats = td->pool_stats;
+    nb_pool_stat_add(stats.hits, pool->hits);
+    nb_pool_stat_add(stats.misses, pool->misses);
+    nb_pool_stat_add(stats.evictions, pool->evictions);
+
+    uint32_t capacity = pool->capacity;
+
+    if (pool->slots) {
+        if (pool->misses && pool->evictions >= pool->events / 8 &&
+            capacity < nb_pool_max_capacity(td)) {
+            uint32_t new_capacity = capacity * 2;
+            if (new_capacity > nb_pool_max_capacity(td))
+                new_capacity = nb_pool_max_capacity(td);
+
+            if (nb_pool_resize(pool, new_capacity))
+                nb_pool_stat_add(stats.grows, 1);
+        } else if (pool->low_water >= capacity / 2 && pool->evictions == 0 &&
+                   capacity > nb_pool_min_capacity(td)) {
+            nb_pool_shrink(td, pool);
+        }
+    }
+
+    pool->events = pool->hits = pool->misses = pool->evictions = 0;
+    pool->low_water = pool->count;
+    pool->idle_mark = UINT32_MAX;
+
+#if defined(NB_FREE_THREADED)
+    uint32_t &windows = nb_thread_state_get(td->internals)->pool_windows;
+#else
+    uint32_t &windows = td->internals->pool_windows;
+#endif
+    if (++windows % nb_pool_sweep_interval == 0)
+        nb_pool_sweep(td->internals);
 }
 
 static void inst_dealloc(PyObject *self) {
@@ -458,11 +623,14 @@ static void inst_dealloc(PyObject *self) {
             // There is space in the pool. Stash the object and release its
             // reference to the type object.
             pool->slots[pool->count++] = inst;
+            nb_pool_tick((type_data *) t, pool);
             NB_DECREF_TYPE(tp);
             return;
         }
 
         // The pool is full. Release without rerunning the destructor
+        pool->evictions++;
+        nb_pool_tick((type_data *) t, pool);
         inst->state.destruct = 0;
     }
 
@@ -484,13 +652,20 @@ static void inst_dealloc(PyObject *self) {
     }
 
     nb_weakref_seq *wr_seq = nullptr;
+    bool identity = !(flags & (uint32_t) type_flags::no_identity) ||
+                    !inst->state.internal;
+    uint8_t keep_alive = inst->state.clear_keep_alive;
 
-    {
+    PyObject *wr_inline = nullptr;
+    if (NB_UNLIKELY(keep_alive & nb_inst_state::keep_alive_inline))
+        wr_inline = nb_inst_keep_alive_slot(inst);
+
+    if (identity || (keep_alive & nb_inst_state::keep_alive_map)) {
         // Enter critical section of shard
         nb_shard &shard = t->internals->shard(p);
         lock_shard guard(shard);
 
-        if (NB_UNLIKELY(inst->state.clear_keep_alive)) {
+        if (NB_UNLIKELY(keep_alive & nb_inst_state::keep_alive_map)) {
             nb_ptr_map &keep_alive = shard.keep_alive;
             nb_ptr_map::iterator it = keep_alive.find(self);
             check(it != keep_alive.end(),
@@ -501,44 +676,49 @@ static void inst_dealloc(PyObject *self) {
             keep_alive.erase_fast(it);
         }
 
-        // Unmap 'inst' from inst_c2p
-        nb_ptr_map &inst_c2p = shard.inst_c2p;
-        nb_ptr_map::iterator it = inst_c2p.find(p);
-
-        bool found = false;
-        if (NB_LIKELY(it != inst_c2p.end())) {
-            void *entry = it->second;
-            if (NB_LIKELY(entry == inst)) {
-                // Fast path: a direct 'p -> inst' mapping.
-                inst_c2p.erase_fast(it);
-                found = true;
-            } else if (nb_is_seq(entry)) {
-                // Multiple instances alias this address. Unlink the right one.
-                nb_inst_seq *seq = nb_get_seq(entry), *pred = nullptr;
-                do {
-                    if ((nb_inst *) seq->inst == inst) {
-                        if (pred)
-                            pred->next = seq->next;
-                        else if (seq->next)
-                            it.value() = nb_mark_seq(seq->next);
-                        else
-                            inst_c2p.erase_fast(it);
-                        PyMem_Free(seq);
-                        found = true;
-                        break;
-                    }
-                    pred = seq;
-                    seq = seq->next;
-                } while (seq);
+        if (identity) {
+            // Unmap 'inst' from inst_c2p
+            nb_inst_map &inst_c2p = shard.inst_c2p;
+            nb_inst_map::iterator it = inst_c2p.find(p);
+
+            bool found = false;
+            if (NB_LIKELY(it != inst_c2p.end())) {
+                void *entry = it->second;
+                if (NB_LIKELY(entry == inst)) {
+                    // Fast path: a direct 'p -> inst' mapping.
+                    inst_c2p.erase_fast(it);
+                    found = true;
+                } else if (nb_is_seq(entry)) {
+                    // Multiple instances alias this address. Unlink the right one.
+                    nb_inst_seq *seq = nb_get_seq(entry), *pred = nullptr;
+                    do {
+                        if ((nb_inst *) seq->inst == inst) {
+                            if (pred)
+                                pred->next = seq->next;
+                            else if (seq->next)
+                                it.value() = nb_mark_seq(seq->next);
+                            else
+                                inst_c2p.erase_fast(it);
+                            PyMem_Free(seq);
+                            found = true;
+                            break;
+                        }
+                        pred = seq;
+                        seq = seq->next;
+                    } while (seq);
+                }
             }
-        }
 
-        check(found,
-              "nanobind::detail::inst_dealloc(): attempted to remove an unknown "
-              "instance (%p) of type \"%s\"!",
-              p, nb_type_data(Py_TYPE((PyObject *) inst))->name);
+            check(found,
+                  "nanobind::detail::inst_dealloc(): attempted to remove an unknown "
+                  "instance (%p) of type \"%s\"!",
+                  p, nb_type_data(Py_TYPE((PyObject *) inst))->name);
+        }
     }
 
+    // The inline patient was added first
+    Py_XDECREF(wr_inline);
+
     while (wr_seq) {
         nb_weakref_seq *c = wr_seq;
         wr_seq = c->next;
@@ -605,6 +785,74 @@ type_data *nb_type_c2p(nb_internals *internals_,
     return nullptr;
 }
 
+/* The 'type_cache' records of type_caster_base<T> memoize the result of
+   nb_type_c2p() for one C++ type. A record is valid while its 'epoch' matches
+   'nb_internals::type_epoch', which nb_type_epoch_bump() replaces whenever
+   'type_c2p_slow' changes. Epochs come from a process-wide counter, so a
+   record never validates against a domain it was not filled from. The record
+   also points to 'type_epoch', which lets the caster check it inline
+   (type_cache_get()) and pass the result to the cached slots; this function
+   then only runs on a miss.
+
+   In free-threaded builds, records are shared between threads and updated
+   following the seqlock pattern: the writer clears 'epoch' before storing
+   'td', and readers re-check 'epoch' after loading 'td'. Writers that fail
+   to acquire 'busy' simply skip the update. */
+
+static std::atomic<uint32_t> type_epoch_counter { 0 };
+
+void nb_type_epoch_bump(nb_internals *p) noexcept {
+    uint32_t epoch;
+    do {
+        epoch = type_epoch_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    } while (NB_UNLIKELY(epoch == 0));
+    p->type_epoch.store_release(epoch);
+}
+
+type_data *nb_type_c2p_cached(nb_internals *internals_,
+                              const std::type_info *type, type_cache *c) {
+    uint32_t epoch = internals_->type_epoch.load_acquire();
+
+#if defined(NB_FREE_THREADED)
+    std::atomic<uint32_t> &c_epoch = *(std::atomic<uint32_t> *) &c->epoch;
+    std::atomic<void *> &c_td = *(std::atomic<void *> *) &c->td;
+
+    if (NB_LIKELY(c_epoch.load(std::memory_order_acquire) == epoch)) {
+        void *td = c_td.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (NB_LIKELY(c_epoch.load(std::memory_order_relaxed) == epoch))
+            return (type_data *) td;
+    }
+
+    type_data *td = nb_type_c2p(internals_, type);
+    std::atomic<uint32_t> &c_busy = *(std::atomic<uint32_t> *) &c->busy;
+
+    if (td && !c_busy.exchange(1, std::memory_order_acquire)) {
+        std::atomic<const uint32_t *> &c_epoch_ptr =
+            *(std::atomic<const uint32_t *> *) &c->epoch_ptr;
+        c_epoch.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        c_td.store(td, std::memory_order_relaxed);
+        c_epoch_ptr.store((const uint32_t *) &internals_->type_epoch.value,
+                          std::memory_order_relaxed);
+        c_epoch.store(epoch, std::memory_order_release);
+        c_busy.store(0, std::memory_order_release);
+    }
+#else
+    if (NB_LIKELY(c->epoch == epoch))
+        return (type_data *) c->td;
+
+    type_data *td = nb_type_c2p(internals_, type);
+    if (td) {
+        c->td = td;
+        c->epoch_ptr = &internals_->type_epoch.value;
+        c->epoch = epoch;
+    }
+#endif
+
+    return td;
+}
+
 void nb_type_unregister(type_data *t) noexcept {
     nb_internals *internals_ = t->internals;
     nb_type_map_slow &type_c2p_slow = internals_->type_c2p_slow;
@@ -612,6 +860,8 @@ void nb_type_unregister(type_data *t) noexcept {
     lock_internals guard(internals_);
     size_t n_del_slow = type_c2p_slow.erase(t->type);
 
+    nb_type_epoch_bump(internals_);
+
 #if defined(NB_FREE_THREADED)
     // In free-threaded mode, stale type information remains in the
     // 'type_c2p_fast' TLS. This data structure is eventually deallocated
@@ -755,6 +1005,7 @@ static NB_NOINLINE int nb_type_init_py(PyTypeObject *self) {
 #else
     tmp.pool = nb_inst_pool{};
 #endif
+    tmp.pool_stats = nb_pool_stats{};
 
     tmp.implicit.cpp = nullptr;
     tmp.implicit.py = nullptr;
@@ -1554,6 +1805,12 @@ static PyObject *nb_type_new_impl(nb_internals *p, const type_data_init *t) {
     if (t_align > ptr_size)
         basicsize += t_align - ptr_size;
 
+    // Instances of types with a small alignment store their data in place of
+    // the 'nb_inst::offset' field (see 'type_flags_internal::is_compact')
+    bool compact = t_align <= alignof(int32_t);
+    if (compact)
+        basicsize -= sizeof(int32_t);
+
     PyObject *base = nullptr;
 
 #if !defined(PYPY_VERSION) // see https://github.com/pypy/pypy/issues/4914
@@ -1792,6 +2049,11 @@ static PyObject *nb_type_new_impl(nb_internals *p, const type_data_init *t) {
         to->keep_shared_from_this_alive = tb->keep_shared_from_this_alive;
     }
 
+    // Subclasses of types without identity tracking share this property, so
+    // that the flag of the static type is authoritative in nb_type_put()
+    if (tb && (tb->flags & (uint32_t) type_flags::no_identity))
+        to->flags |= (uint32_t) type_flags::no_identity;
+
     if (NB_DYNAMIC_VERSION < 0x030E0000) {
         // On Python 3.14+, use Py_tp_vectorcall to set the type vectorcall
         // slot. Otherwise, assign tp_vectorcall or use a workaround (via
@@ -1835,6 +2097,8 @@ static PyObject *nb_type_new_impl(nb_internals *p, const type_data_init *t) {
         PyType_HasFeature((PyTypeObject *) result, Py_TPFLAGS_HAVE_GC);
     if (have_gc)
         to->flags |= (uint32_t) type_flags_internal::has_gc;
+    if (compact)
+        to->flags |= (uint32_t) type_flags_internal::is_compact;
 
     // Instance pool setup + eligibility check (nb::pooled). Decide once here
     // so the hot paths can trust the 'pooled' flag alone.
@@ -1879,6 +2143,7 @@ static PyObject *nb_type_new_impl(nb_internals *p, const type_data_init *t) {
     {
         lock_internals guard(internals_);
         internals_->type_c2p_slow[t->type] = to;
+        nb_type_epoch_bump(internals_);
 
         #if !defined(NB_FREE_THREADED)
             internals_->type_c2p_fast[(void *) t->type] = to;
@@ -1998,10 +2263,21 @@ NB_NOINLINE static bool nb_type_get_state_error(uint8_t state,
     return false;
 }
 
+/// nb_type_c2p(), or the record 'td' found valid in 'c' by the caller, or
+/// a lookup memoized in 'c' when given
+NB_INLINE type_data *nb_type_c2p_opt(nb_internals *p,
+                                     const std::type_info *type,
+                                     type_cache *c, type_data *td) {
+    if (td)
+        return td;
+    return c ? nb_type_c2p_cached(p, type, c) : nb_type_c2p(p, type);
+}
+
 // Attempt to retrieve a pointer to a C++ instance
-bool nb_type_get(nb_internals *p, const std::type_info *cpp_type,
-                 PyObject *src, uint32_t flags, cleanup_list *cleanup,
-                 void **out) noexcept {
+NB_INLINE bool nb_type_get_impl(nb_internals *p, const std::type_info *cpp_type,
+                                type_cache *c, type_data *td_c, PyObject *src,
+                                uint32_t flags,
+                                cleanup_list *cleanup, void **out) noexcept {
     static_assert(cast_flags::construct == nb_inst_state::state_ready,
                   "this function is optimized assuming that "
                   "cast_flags::construct == nb_inst_state::state_ready");
@@ -2039,7 +2315,7 @@ bool nb_type_get(nb_internals *p, const std::type_info *cpp_type,
 
         // If not, look up the Python type and check the inheritance chain
         if (NB_UNLIKELY(!valid)) {
-            dst_type = nb_type_c2p(internals_, cpp_type);
+            dst_type = nb_type_c2p_opt(internals_, cpp_type, c, td_c);
             if (dst_type)
                 valid = PyType_IsSubtype(src_type, dst_type->type_py);
         }
@@ -2069,7 +2345,7 @@ bool nb_type_get(nb_internals *p, const std::type_info *cpp_type,
     // Try an implicit conversion as last resort (if possible & requested)
     if ((flags & (uint16_t) cast_flags::convert) && cleanup) {
         if (!src_is_nb_type)
-            dst_type = nb_type_c2p(internals_, cpp_type);
+            dst_type = nb_type_c2p_opt(internals_, cpp_type, c, td_c);
 
         if (dst_type &&
             (dst_type->flags & (uint32_t) type_flags_internal::has_implicit_conversions))
@@ -2080,6 +2356,20 @@ bool nb_type_get(nb_internals *p, const std::type_info *cpp_type,
     return false;
 }
 
+bool nb_type_get(nb_internals *p, const std::type_info *cpp_type,
+                 PyObject *src, uint32_t flags, cleanup_list *cleanup,
+                 void **out) noexcept {
+    return nb_type_get_impl(p, cpp_type, nullptr, nullptr, src, flags,
+                            cleanup, out);
+}
+
+bool nb_type_get_cached(nb_internals *p, const std::type_info *cpp_type,
+                        type_cache *c, void *td, PyObject *src, uint32_t flags,
+                        cleanup_list *cleanup, void **out) noexcept {
+    return nb_type_get_impl(p, cpp_type, c, (type_data *) td, src, flags,
+                            cleanup, out);
+}
+
 static PyObject *keep_alive_callback(PyObject *self, PyObject *const *args,
                                      Py_ssize_t nargs) {
     check(nargs == 1 && PyWeakref_CheckRefExact(args[0]),
@@ -2094,14 +2384,52 @@ static PyMethodDef keep_alive_callback_def = {
     METH_FASTCALL, nullptr
 };
 
+/// Set a bit of the 'clear_keep_alive' field, which other threads may update
+/// concurrently
+static void keep_alive_flag(nb_inst *inst, uint8_t bit) noexcept {
+#if defined(NB_FREE_THREADED)
+    ((std::atomic<uint8_t> *) &inst->state.clear_keep_alive)
+        ->fetch_or(bit, std::memory_order_relaxed);
+#else
+    inst->state.clear_keep_alive |= bit;
+#endif
+}
+
 void keep_alive_py(nb_internals *p, PyObject *nurse, PyObject *patient) {
     PyObject *none = none_ptr();
     if (!patient || !nurse || nurse == none || patient == none)
         return;
 
     if (nb_type_check(p, (PyObject *) Py_TYPE(nurse))) {
+        nb_inst *inst = (nb_inst *) nurse;
+
+        // Common case: store the first patient in the inline slot, which
+        // needs neither the shard lock nor a 'keep_alive' record
+        if (inst->state.keep_alive_slot) {
+            PyObject *&slot = nb_inst_keep_alive_slot(inst),
+                     *expected = nullptr;
 #if defined(NB_FREE_THREADED)
-        nb_shard &shard = p->shard(inst_ptr((nb_inst *) nurse));
+            bool claimed = ((std::atomic<PyObject *> *) &slot)
+                               ->compare_exchange_strong(
+                                   expected, patient, std::memory_order_relaxed);
+#else
+            bool claimed = !slot;
+            if (claimed)
+                slot = patient;
+            else
+                expected = slot;
+#endif
+            if (claimed) {
+                Py_INCREF(patient);
+                keep_alive_flag(inst, nb_inst_state::keep_alive_inline);
+                return;
+            } else if (expected == patient) {
+                return;
+            }
+        }
+
+#if defined(NB_FREE_THREADED)
+        nb_shard &shard = p->shard(inst_ptr(inst));
         lock_shard guard(shard);
 #else
         nb_shard &shard = p->shards[0];
@@ -2127,7 +2455,7 @@ void keep_alive_py(nb_internals *p, PyObject *nurse, PyObject *patient) {
         *pp = s;
 
         Py_INCREF(patient);
-        ((nb_inst *) nurse)->state.clear_keep_alive = true;
+        keep_alive_flag(inst, nb_inst_state::keep_alive_map);
     } else {
         PyObject *callback =
             PyCFunction_New(&keep_alive_callback_def, patient);
@@ -2171,7 +2499,7 @@ void keep_alive_ptr(nb_internals *p, PyObject *nurse, void *payload,
         s->next = *pp;
         *pp = s;
 
-        ((nb_inst *) nurse)->state.clear_keep_alive = true;
+        keep_alive_flag((nb_inst *) nurse, nb_inst_state::keep_alive_map);
     } else {
         auto capsule_cleanup = [](PyObject *o) {
             auto callback_2 = (void (*)(void *)) PyCapsule_GetContext(o);
@@ -2281,11 +2609,13 @@ static PyObject *nb_type_put_common(void *value, type_data *t, rv_policy rvp,
     return (PyObject *) inst;
 }
 
-PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
-                      const std::type_info *cpp_type_p,
-                      void *value, rv_policy rvp,
-                      cleanup_list *cleanup,
-                      bool *is_new) noexcept {
+NB_INLINE PyObject *nb_type_put_impl(nb_internals *p,
+                                     const std::type_info *cpp_type,
+                                     const std::type_info *cpp_type_p,
+                                     type_cache *c, type_data *td_c,
+                                     void *value, rv_policy rvp,
+                                     cleanup_list *cleanup,
+                                     bool *is_new) noexcept {
     // Convert nullptr -> None
     if (!value)
         return none_ref();
@@ -2297,9 +2627,10 @@ PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
     type_data *td = nullptr,
               *td_p = nullptr;
 
-    auto lookup_type = [cpp_type, cpp_type_p, internals_, &td, &td_p]() -> bool {
+    auto lookup_type = [cpp_type, cpp_type_p, c, td_c, internals_, &td,
+                        &td_p]() -> bool {
         if (!td) {
-            type_data *d = nb_type_c2p(internals_, cpp_type);
+            type_data *d = nb_type_c2p_opt(internals_, cpp_type, c, td_c);
             if (!d)
                 return false;
             td = d;
@@ -2311,13 +2642,53 @@ PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
         return true;
     };
 
-    if (rvp != rv_policy::copy) {
+    // Types that opt out of identity tracking create a new wrapper for each
+    // instance returned by value. Pointers are still looked up, since the
+    // wrapper that references them may own them.
+    bool identity =
+        rvp != rv_policy::copy &&
+        (rvp != rv_policy::move || !lookup_type() ||
+         !(td->flags & (uint32_t) type_flags::no_identity));
+
+    if (identity) {
         nb_shard &shard = internals_->shard(value);
+
+#if defined(NB_FREE_THREADED)
+        // Lock-free fast path for registered instances (see nb_inst_map).
+        // The object may die and its memory may be reused concurrently, so
+        // its registration must be confirmed after acquiring the reference.
+        // CPython's lock-free reads of dict/list items work the same way.
+        //
+        // Reading the reference count of a dead object is safe: instances
+        // come from the object heaps of CPython's mimalloc allocator, which
+        // keeps the reference count fields intact when a block is freed, and
+        // which only returns a page to the OS or to another size class
+        // after a QSBR grace period, i.e. once all threads have passed a
+        // quiescent state. This thread cannot pass one during the lookup,
+        // so 'known' points to a (possibly dead or reused) object, and
+        // nb_try_inc_ref() fails for dead ones. Retired slot arrays of the
+        // table stay allocated until the map is destroyed.
+        PyObject *known = (PyObject *) shard.inst_c2p.lookup(value);
+        if (known && !nb_is_seq(known) && nb_try_inc_ref(known)) {
+            if (NB_LIKELY(shard.inst_c2p.lookup(value) == known)) {
+                PyTypeObject *tp = Py_TYPE(known);
+                const std::type_info *p = nb_type_data(tp)->type;
+
+                if (p == cpp_type || p == cpp_type_p ||
+                    (lookup_type() &&
+                     (PyType_IsSubtype(tp, td->type_py) ||
+                      (td_p && PyType_IsSubtype(tp, td_p->type_py)))))
+                    return known;
+            }
+            Py_DECREF(known);
+        }
+#endif
+
         lock_shard guard(shard);
 
         // Check if the instance is already registered with nanobind
-        nb_ptr_map &inst_c2p = shard.inst_c2p;
-        nb_ptr_map::iterator it = inst_c2p.find(value);
+        nb_inst_map &inst_c2p = shard.inst_c2p;
+        nb_inst_map::iterator it = inst_c2p.find(value);
 
         if (it != inst_c2p.end()) {
             void *entry = it->second;
@@ -2357,6 +2728,8 @@ PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
         } else if (rvp == rv_policy::none) {
             return nullptr;
         }
+    } else if (rvp == rv_policy::none) {
+        return nullptr;
     }
 
     // Look up the corresponding Python type if not already done
@@ -2366,6 +2739,225 @@ PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
     return nb_type_put_common(value, td_p ? td_p : td, rvp, cleanup, is_new);
 }
 
+PyObject *nb_type_put(nb_internals *p, const std::type_info *cpp_type,
+                      const std::type_info *cpp_type_p,
+                      void *value, rv_policy rvp,
+                      cleanup_list *cleanup,
+                      bool *is_new) noexcept {
+    return nb_type_put_impl(p, cpp_type, cpp_type_p, nullptr, nullptr, value,
+                            rvp, cleanup, is_new);
+}
+
+PyObject *nb_type_put_cached(nb_internals *p, const std::type_info *cpp_type,
+                             const std::type_info *cpp_type_p, type_cache *c,
+                             void *td, void *value, rv_policy rvp,
+                             cleanup_list *cleanup, bool *is_new) noexcept {
+    return nb_type_put_impl(p, cpp_type, cpp_type_p, c, (type_data *) td,
+                            value, rvp, cleanup, is_new);
+}
+
+/// Locks the shards of a sequence of 'inst_c2p' keys. Consecutive keys usually
+/// map to the same shard (see 'nb_internals::shard()'), so the lock is only
+/// switched when the shard changes.
+struct lock_shard_run {
+    nb_internals *p;
+#if defined(NB_FREE_THREADED)
+    nb_shard *cur = nullptr;
+    bool counted = false;
+
+    nb_shard &operator()(void *ptr) {
+        nb_shard &s = p->shard(ptr);
+        if (&s != cur) {
+            if (cur)
+                nb_shard_unlock(*cur, counted);
+            counted = nb_shard_lock(s);
+            cur = &s;
+        }
+        return s;
+    }
+
+    ~lock_shard_run() {
+        if (cur)
+            nb_shard_unlock(*cur, counted);
+    }
+#else
+    nb_shard &operator()(void *ptr) { return p->shard(ptr); }
+#endif
+};
+
+/// Per-element fallback of 'nb_type_put_n()'
+static bool nb_type_put_n_each(nb_internals *p, const std::type_info *cpp_type,
+                               uint8_t *values, size_t stride, size_t n,
+                               rv_policy rvp, cleanup_list *cleanup,
+                               PyObject **out) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        PyObject *o = nb_type_put(p, cpp_type, nullptr, values + i * stride,
+                                  rvp, cleanup, nullptr);
+        if (NB_UNLIKELY(!o)) {
+            for (size_t j = 0; j < i; ++j) {
+                Py_DECREF(out[j]);
+                out[j] = nullptr;
+            }
+            return false;
+        }
+        out[i] = o;
+    }
+
+    return true;
+}
+
+bool nb_type_put_n(nb_internals *p, const std::type_info *cpp_type,
+                   void *values_, size_t stride, size_t n, rv_policy rvp,
+                   cleanup_list *cleanup, PyObject **out) noexcept {
+    uint8_t *values = (uint8_t *) values_;
+
+    type_data *t = nb_type_c2p(p, cpp_type);
+    if (!t)
+        return false;
+
+    uint32_t flags = t->flags;
+
+    // The batched path only handles policies that create new instances.
+    // Intrusively reference-counted types always take ownership instead.
+    if ((rvp != rv_policy::copy && rvp != rv_policy::move) ||
+        (flags & (uint32_t) type_flags::intrusive_ptr))
+        return nb_type_put_n_each(p, cpp_type, values, stride, n, rvp, cleanup,
+                                  out);
+
+    bool identity = !(flags & (uint32_t) type_flags::no_identity);
+
+    if (rvp == rv_policy::move) {
+        // 'nb_type_put()' returns existing instances when asked to move an
+        // object that is already known to nanobind. This is rare, so simply
+        // take the per-element route when it happens.
+        bool known = false;
+        if (identity) {
+            lock_shard_run lock { p };
+            for (size_t i = 0; i < n && !known; ++i) {
+                void *value = values + i * stride;
+                nb_inst_map &inst_c2p = lock(value).inst_c2p;
+                known = inst_c2p.find(value) != inst_c2p.end();
+            }
+        }
+
+        if (NB_UNLIKELY(known))
+            return nb_type_put_n_each(p, cpp_type, values, stride, n, rvp,
+                                      cleanup, out);
+
+        if (!(flags & (uint32_t) type_flags::is_move_constructible))
+            rvp = rv_policy::copy;
+    }
+
+    check(rvp == rv_policy::move ||
+              (flags & (uint32_t) type_flags::is_copy_constructible),
+          "nanobind::detail::nb_type_put_n(\"%s\"): attempted to copy an "
+          "instance that is not copy-constructible!", t->name);
+
+    PyTypeObject *tp = t->type_py;
+    size_t i = 0;
+
+    // Step 1: take as many instances as possible from the pool. These are
+    // still registered in 'inst_c2p' (unless the type has 'no_identity').
+    if (flags & (uint32_t) type_flags::pooled) {
+        nb_inst_pool *pool = nb_pool_lookup(t);
+        if (pool) {
+            size_t count = pool->count,
+                   k = count < n ? count : n;
+
+            for (; i < k; ++i) {
+                nb_inst *self = pool->slots[count - 1 - i];
+                inst_revive(tp, flags, self);
+                out[i] = (PyObject *) self;
+            }
+
+            pool->count = (uint32_t) (count - k);
+
+            if (pool->slots) {
+                pool->hits += (uint32_t) k;
+                pool->misses += (uint32_t) (n - k);
+                nb_pool_tick(t, pool, (uint32_t) n);
+            }
+        }
+    }
+
+    // Step 2: allocate the remainder
+    size_t first_new = i;
+    for (; i < n; ++i) {
+        nb_inst *self = inst_alloc_int(tp, t);
+        if (NB_UNLIKELY(!self))
+            break;
+        out[i] = (PyObject *) self;
+    }
+    size_t n_alloc = i;
+
+    // Step 3: register the new instances, grouping the updates by shard
+    if (identity) {
+        lock_shard_run lock { p };
+        for (size_t j = first_new; j < n_alloc; ++j) {
+            void *payload = inst_ptr((nb_inst *) out[j]);
+            auto [it, success] =
+                lock(payload).inst_c2p.try_emplace(payload, out[j]);
+            check(success,
+                  "nanobind::detail::nb_type_put_n(): unexpected collision!");
+        }
+    }
+
+    bool success = n_alloc == n;
+
+    // Step 4: copy/move-construct the instances
+    if (NB_LIKELY(success)) {
+        bool has_copy = flags & (uint32_t) type_flags::has_copy,
+             has_move = flags & (uint32_t) type_flags::has_move;
+        size_t size = t->size;
+
+        for (i = 0; i < n; ++i) {
+            nb_inst *inst = (nb_inst *) out[i];
+            void *new_value = inst_ptr(inst),
+                 *value = values + i * stride;
+
+            if (rvp == rv_policy::move) {
+                if (has_move) {
+                    try {
+                        t->move(new_value, value);
+                    } catch (...) {
+                        success = false;
+                        break;
+                    }
+                } else {
+                    memcpy(new_value, value, size);
+                    memset(value, 0, size);
+                }
+            } else {
+                if (has_copy) {
+                    try {
+                        t->copy(new_value, value);
+                    } catch (...) {
+                        success = false;
+                        break;
+                    }
+                } else {
+                    memcpy(new_value, value, size);
+                }
+            }
+
+            inst->state.destruct = 1;
+            inst->state.state = nb_inst_state::state_ready;
+        }
+    }
+
+    if (NB_UNLIKELY(!success)) {
+        // Instances that were not constructed yet are still uninitialized.
+        // Clear the entries, since the caller may release 'out' as well.
+        for (size_t j = 0; j < n_alloc; ++j) {
+            Py_DECREF(out[j]);
+            out[j] = nullptr;
+        }
+        return false;
+    }
+
+    return true;
+}
+
 static void nb_type_put_unique_finalize(PyObject *o,
                                         const std::type_info *cpp_type,
                                         bool cpp_delete, bool is_new) {
@@ -2507,6 +3099,64 @@ size_t nb_type_align(PyObject *t) noexcept {
     return nb_type_data((PyTypeObject *) t)->align;
 }
 
+PyObject *nb_type_pool_stats(nb_internals *p, PyObject *t) noexcept {
+    if (!PyType_Check(t) || !PyType_IsSubtype(Py_TYPE(t), p->nb_type)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "nanobind::type_pool_stats(): expected a nanobind "
+                        "type object!");
+        return nullptr;
+    }
+
+    type_data *td = nb_type_data((PyTypeObject *) t);
+    nb_pool_stats stats;
+#if defined(NB_FREE_THREADED)
+    auto load = [](uint64_t &value) {
+        return ((std::atomic<uint64_t> *) &value)->load(std::memory_order_relaxed);
+    };
+    stats.hits = load(td->pool_stats.hits);
+    stats.misses = load(td->pool_stats.misses);
+    stats.evictions = load(td->pool_stats.evictions);
+    stats.grows = load(td->pool_stats.grows);
+    stats.shrinks = load(td->pool_stats.shrinks);
+#else
+    stats = td->pool_stats;
+#endif
+
+    // Include the unpublished counters of the current window
+    uint32_t capacity = 0, count = 0;
+    nb_inst_pool *pool = nullptr;
+    if (td->flags & (uint32_t) type_flags::pooled)
+        pool = nb_pool_lookup(td);
+    if (pool && pool->slots) {
+        stats.hits += pool->hits;
+        stats.misses += pool->misses;
+        stats.evictions += pool->evictions;
+        capacity = pool->capacity;
+        count = pool->count;
+    }
+
+    const char *names[] = { "hits",   "misses",   "evictions", "grows",
+                            "shrinks", "capacity", "count" };
+    uint64_t values[] = { stats.hits,    stats.misses, stats.evictions,
+                          stats.grows,   stats.shrinks, capacity, count };
+
+    PyObject *result = PyDict_New();
+    if (!result)
+        return nullptr;
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(uint64_t); ++i) {
+        PyObject *value = PyLong_FromUnsignedLongLong(values[i]);
+        if (!value || PyDict_SetItemString(result, names[i], value)) {
+            Py_XDECREF(value);
+            Py_DECREF(result);
+            return nullptr;
+        }
+        Py_DECREF(value);
+    }
+
+    return result;
+}
+
 const std::type_info *nb_type_info(PyObject *t) noexcept {
     return nb_type_data((PyTypeObject *) t)->type;
 }
@@ -1125,6 +1125,9 @@ class StubGen:
                 if tp_name == "nb_static_property":
                     value = cast(NbStaticProperty, value)
                     self.put_nb_static_property(name, value, parent)
+                elif tp_name == "nb_member":
+                    value = cast(property, value)
+                    self.put_property(value, name)
             elif tp_mod == "builtins":
                 if tp is property:
                     value = cast(property, value)
@@ -183,8 +183,8 @@ PyObject *trampoline_new(nb_internals *p, void *ptr) noexcept {
     nb_shard &shard = p->shard(ptr);
     lock_shard lock(shard);
 
-    nb_ptr_map &inst_c2p = shard.inst_c2p;
-    nb_ptr_map::iterator it = inst_c2p.find(ptr);
+    nb_inst_map &inst_c2p = shard.inst_c2p;
+    nb_inst_map::iterator it = inst_c2p.find(ptr);
     check(it != inst_c2p.end() && (((uintptr_t) it->second) & 1) == 0,
           "nanobind::detail::trampoline_new(): unique instance not found!");
     return (PyObject *) it->second;
@@ -0,0 +1,34 @@
+"""Benchmark of overload resolution with and without nb::cache_overloads().
+
+Calls that resolve to an overload late in a long chain are timed against the
+same chain with the overload resolution cache enabled. The cache applies
+when the overloads in front of the match differ in the number or names of
+their arguments:
+
+    python bench_functions.py
+"""
+
+import timeit
+
+import test_functions_ext as t
+
+CASES = [
+    ("positional", lambda f: f(1, "x")),
+    ("keyword", lambda f: f(a=1, b="x")),
+    ("by type", lambda f: f("x")),
+]
+
+
+def main():
+    for name, call in CASES:
+        times = []
+        for f in (t.test_ov_chain, t.test_ov_chain_cached):
+            times.append(min(timeit.repeat(lambda: call(f), number=100000,
+                                           repeat=5)))
+        print(f"overload resolution ({name}): "
+              f"{times[0] * 1e4:.1f} ns/call uncached, "
+              f"{times[1] * 1e4:.1f} ns/call cached")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,232 @@
+"""Multi-threaded throughput benchmark of nanobind's hot paths.
+
+Each benchmark runs a loop of calls into 'test_thread_ext' on 1, 2, 4, ...
+threads for a fixed duration and reports the aggregate number of calls per
+second. On free-threaded builds, the throughput should grow with the thread
+count; on GIL builds, it stays roughly constant. Results can be written as
+JSON and compared against an earlier run to detect scaling regressions:
+
+    python bench_thread.py --json base.json
+    python bench_thread.py --baseline base.json --tolerance 0.2
+"""
+
+import argparse
+import json
+import os
+import platform
+import sys
+import sysconfig
+import threading
+import time
+
+import test_thread_ext as t
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+# Calls per timing check, to keep the overhead of time.perf_counter() small
+BATCH = 64
+
+
+def _bench_dispatch():
+    f = t.bench_noop
+    def run():
+        for _ in range(BATCH):
+            f(1, 2)
+    return run
+
+
+def _bench_pool():
+    cls = t.BenchPooled
+    def run():
+        for i in range(BATCH):
+            cls(i)
+    return run
+
+
+def _bench_inst_c2p():
+    # Reference-policy returns of registered instances ('inst_c2p' lookup)
+    f, objs = t.bench_return_ref, [t.Counter() for _ in range(BATCH)]
+    def run():
+        for o in objs:
+            f(o)
+    return run
+
+
+def _bench_keep_alive():
+    # Each access creates a child wrapper with a keep_alive reference
+    parent = t.BenchParent()
+    def run():
+        for _ in range(BATCH):
+            parent.child
+    return run
+
+
+def _bench_trampoline():
+    class Derived(t.BenchBase):
+        def value(self):
+            return 1
+
+    f, obj = t.bench_call_virtual, Derived()
+    def run():
+        for _ in range(BATCH):
+            f(obj)
+    return run
+
+
+def _bench_ndarray():
+    if np is not None:
+        a = np.zeros(16, dtype=np.float32)
+    else:
+        import array
+        a = array.array('f', [0.0] * 16)
+    f = t.bench_ndarray
+    def run():
+        for _ in range(BATCH):
+            f(a)
+    return run
+
+
+def _bench_implicit():
+    f = t.bench_implicit
+    def run():
+        for _ in range(BATCH):
+            f(1.0)
+    return run
+
+
+BENCHMARKS = {
+    "dispatch": _bench_dispatch,
+    "pool": _bench_pool,
+    "inst_c2p": _bench_inst_c2p,
+    "keep_alive": _bench_keep_alive,
+    "trampoline": _bench_trampoline,
+    "ndarray": _bench_ndarray,
+    "implicit": _bench_implicit,
+}
+
+
+def measure(make, n_threads, duration):
+    """Return the aggregate calls per second of 'n_threads' threads, each
+    running the loop created by 'make()' for 'duration' seconds."""
+    barrier = threading.Barrier(n_threads + 1)
+    counts = [0] * n_threads
+    errors = []
+
+    def worker(i):
+        try:
+            run = make()
+            run()  # warm up
+        except BaseException as e:
+            errors.append(e)
+            barrier.abort()
+            return
+        barrier.wait()
+        n, end = 0, time.perf_counter() + duration
+        while time.perf_counter() < end:
+            run()
+            n += 1
+        counts[i] = n * BATCH
+
+    workers = [threading.Thread(target=worker, args=(i,))
+               for i in range(n_threads)]
+    for w in workers:
+        w.start()
+    try:
+        barrier.wait()
+        start = time.perf_counter()
+    except threading.BrokenBarrierError:
+        pass
+    for w in workers:
+        w.join()
+    if errors:
+        raise errors[0]
+
+    return sum(counts) / (time.perf_counter() - start)
+
+
+def run(threads, duration, names=None):
+    """Run the benchmarks 'names' (default: all) and return the results as a
+    JSON-compatible dictionary."""
+    results = {}
+    for name in names or BENCHMARKS:
+        rates = {}
+        for n in threads:
+            rates[str(n)] = measure(BENCHMARKS[name], n, duration)
+        base = rates[str(threads[0])]
+        results[name] = {
+            "calls_per_second": rates,
+            "speedup": {k: v / base for k, v in rates.items()},
+        }
+
+    return {
+        "python": platform.python_version(),
+        "implementation": platform.python_implementation(),
+        "free_threaded": bool(sysconfig.get_config_var("Py_GIL_DISABLED")),
+        "gil_enabled": getattr(sys, "_is_gil_enabled", lambda: True)(),
+        "cpu_count": os.cpu_count(),
+        "shard_count": t.shard_stats()["count"],
+        "threads": list(threads),
+        "duration": duration,
+        "ndarray_source": "numpy" if np is not None else "array",
+        "benchmarks": results,
+    }
+
+
+def compare(result, baseline, tolerance):
+    """Return messages describing benchmarks whose speedup at some thread
+    count fell below that of 'baseline' by more than 'tolerance'."""
+    messages = []
+    for name, entry in result["benchmarks"].items():
+        ref = baseline.get("benchmarks", {}).get(name)
+        if ref is None:
+            continue
+        for n, speedup in entry["speedup"].items():
+            ref_speedup = ref["speedup"].get(n)
+            if ref_speedup and speedup < ref_speedup * (1 - tolerance):
+                messages.append(f"{name} @ {n} threads: speedup {speedup:.2f} "
+                                f"(baseline {ref_speedup:.2f})")
+    return messages
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--threads", default="1,2,4,8,16,32,64",
+                        help="comma-separated thread counts")
+    parser.add_argument("--duration", type=float, default=0.5,
+                        help="seconds per measurement")
+    parser.add_argument("--bench", action="append", choices=list(BENCHMARKS),
+                        help="benchmark to run (default: all)")
+    parser.add_argument("--json", help="write the results to this file")
+    parser.add_argument("--baseline",
+                        help="fail if the scaling is worse than in this file")
+    parser.add_argument("--tolerance", type=float, default=0.2,
+                        help="permitted relative speedup loss (default: 0.2)")
+    args = parser.parse_args()
+
+    threads = sorted({int(n) for n in args.threads.split(",")})
+    result = run(threads, args.duration, args.bench)
+
+    header = "benchmark".ljust(12) + "".join(f"{n:>12}" for n in threads)
+    print(header + "   (calls/s)")
+    for name, entry in result["benchmarks"].items():
+        rates = entry["calls_per_second"].values()
+        print(name.ljust(12) + "".join(f"{r:12.3g}" for r in rates))
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(result, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            messages = compare(result, json.load(f), args.tolerance)
+        for m in messages:
+            print("regression: " + m, file=sys.stderr)
+        if messages:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
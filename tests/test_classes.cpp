@@ -77,6 +77,12 @@ struct OptionalNoneTest {
     }
 };
 
+// Bound at runtime by late_bind()
+struct Late { int value; };
+
+// Bound at runtime by transient_bind() in a module that is later discarded
+struct Transient { int value; };
+
 struct Big {
     char data[1024];
     Big() { memset(data, 0xff, 1024); }
@@ -1072,4 +1078,117 @@ NB_MODULE(test_classes_ext, m) {
     m.def("inst_dict_insert", [](nb::handle h, const char *name, nb::handle value) {
         nb::inst_dict(h)[name] = value;
     });
+
+    // Scalar fields accessed via the 'nb_member' descriptor
+    enum class MemberEnum : int16_t { A = -1, B = 2 };
+    nb::enum_<MemberEnum>(m, "MemberEnum")
+        .value("A", MemberEnum::A)
+        .value("B", MemberEnum::B);
+
+    struct MemberBase { int32_t base = 1; };
+    struct Members : MemberBase {
+        virtual ~Members() = default;
+        bool b = true;
+        int8_t i8 = -8;
+        uint16_t u16 = 16;
+        int64_t i64 = -64;
+        uint64_t u64 = 64;
+        float f32 = 0.5f;
+        double f64 = 0.25;
+        MemberEnum e = MemberEnum::B;
+        std::string s = "str";
+    };
+
+    nb::class_<Members>(m, "Members")
+        .def(nb::init<>())
+        .def_rw("base", &Members::base)
+        .def_rw("b", &Members::b)
+        .def_rw("i8", &Members::i8, "An 8-bit integer")
+        .def_rw("u16", &Members::u16)
+        .def_rw("i64", &Members::i64)
+        .def_rw("u64", &Members::u64)
+        .def_rw("f32", &Members::f32)
+        .def_rw("f64", &Members::f64)
+        .def_rw("e", &Members::e)
+        .def_rw("s", &Members::s)
+        .def_ro("i64_ro", &Members::i64)
+        .def_rw("i64_policy", &Members::i64, nb::for_getter(nb::rv_policy::copy))
+        .def_prop_rw("i64_prop",
+                     [](const Members &m) { return m.i64; },
+                     [](Members &m, int64_t v) { m.i64 = v; });
+
+    // Fields declared by a base class at a nonzero offset
+    struct MemberBase2 { double base2 = 2.5; };
+    struct Members2 : MemberBase, MemberBase2 { int16_t i16 = 7; };
+
+    nb::class_<Members2>(m, "Members2")
+        .def(nb::init<>())
+        .def_rw("base", &Members2::base)
+        .def_rw("base2", &Members2::base2)
+        .def_rw("i16", &Members2::i16);
+
+    // Types without identity tracking (nb::no_identity)
+    struct Color { float r = 0, g = 0, b = 0; };
+    struct ColorEx : Color { };
+    static Color color_global;
+
+    nb::class_<Color>(m, "Color", nb::no_identity(), nb::pooled(4))
+        .def(nb::init<>())
+        .def_rw("r", &Color::r)
+        .def_prop_ro_static("shared",
+                            [](nb::handle) -> Color & { return color_global; },
+                            nb::rv_policy::reference);
+    nb::class_<ColorEx, Color>(m, "ColorEx")
+        .def(nb::init<>());
+
+    m.def("color_find", [](nb::handle h) {
+        return nb::find(nb::cast<Color &>(h)).is_valid();
+    });
+    m.def("color_ex_ref", [](ColorEx &c) -> ColorEx & { return c; },
+          nb::rv_policy::reference);
+
+    static Color *color_owned = nullptr;
+    m.def("color_owned_new", []() { return color_owned = new Color(); },
+          nb::rv_policy::take_ownership);
+    m.def("color_owned_get", []() { return color_owned; },
+          nb::rv_policy::take_ownership);
+
+    // Compact instance layout of types with a small alignment
+    struct Vec3f { float x = 0, y = 0, z = 0; };
+    struct Segment { Vec3f a, b; };
+
+    nb::class_<Vec3f>(m, "Vec3f")
+        .def(nb::init<float, float, float>())
+        .def_rw("x", &Vec3f::x)
+        .def_rw("y", &Vec3f::y)
+        .def_rw("z", &Vec3f::z)
+        .def("__add__", [](const Vec3f &a, const Vec3f &b) {
+            return Vec3f{ a.x + b.x, a.y + b.y, a.z + b.z };
+        }, nb::is_operator());
+
+    nb::class_<Segment>(m, "Segment")
+        .def(nb::init<>())
+        .def_rw("a", &Segment::a)
+        .def_rw("b", &Segment::b);
+
+    // Adaptive instance pool capacity
+    struct Burst { int value; };
+
+    nb::class_<Burst>(m, "Burst", nb::pooled(4))
+        .def(nb::init<int>());
+
+    m.def("pool_stats", [](nb::handle h) { return nb::type_pool_stats(h); });
+
+    // Type lookups cached before the type is bound
+    m.def("late_get", []() { return Late{ 7 }; });
+    m.def("late_value", [](const Late &l) { return l.value; });
+    m.def("late_bind", [](nb::module_ m) {
+        nb::class_<Late>(m, "Late");
+    });
+
+    m.def("transient_get", []() { return Transient{ 3 }; });
+    m.def("transient_value", [](const Transient &t) { return t.value; });
+    m.def("transient_bind", [](nb::module_ m) {
+        nb::class_<Transient>(m, "Transient");
+    });
 }
@@ -1421,3 +1421,263 @@ def test66_uninitialized_type_use():
 
     assert isinstance(Derived7.companion, Derived7)
     assert Derived7.companion.name() == "Animal"
+
+
+def test67_member_descriptors():
+    member = type(t.Members.__dict__["i8"])
+    assert member.__name__ == "nb_member" and issubclass(member, property)
+    for name in ("base", "b", "i8", "u16", "i64", "u64", "f32", "f64", "e", "i64_ro"):
+        assert type(t.Members.__dict__[name]) is member
+    for name in ("s", "i64_policy", "i64_prop"):
+        assert type(t.Members.__dict__[name]) is property
+    assert t.Members.__dict__["i8"].__doc__ == "An 8-bit integer"
+    assert t.Members.__dict__["i64_ro"].fset is None
+
+    m = t.Members()
+    assert (m.base, m.b, m.i8, m.u16, m.i64, m.u64, m.f32, m.f64, m.e, m.s) == \
+        (1, True, -8, 16, -64, 64, 0.5, 0.25, t.MemberEnum.B, "str")
+
+    m.base, m.b, m.i8, m.u16 = -1, False, -128, 65535
+    m.i64, m.u64, m.f32, m.f64 = -2**63, 2**64 - 1, 1.5, 3
+    m.e, m.s = t.MemberEnum.A, "x"
+    assert (m.base, m.b, m.i8, m.u16, m.i64, m.u64, m.f32, m.f64, m.e, m.s) == \
+        (-1, False, -128, 65535, -2**63, 2**64 - 1, 1.5, 3.0, t.MemberEnum.A, "x")
+    assert m.i64_ro == m.i64_policy == m.i64_prop == -2**63
+    assert isinstance(m.f64, float)
+
+    # Incompatible values are reported by the bound setter
+    for name, value in (("b", 1), ("i8", 128), ("u16", -1), ("u64", 2**64),
+                        ("f32", "1"), ("e", 3), ("i64", None)):
+        with pytest.raises(TypeError, match="incompatible function arguments"):
+            setattr(m, name, value)
+    assert (m.b, m.i8, m.u16, m.e) == (False, -128, 65535, t.MemberEnum.A)
+
+    with pytest.raises(AttributeError):
+        m.i64_ro = 1
+    with pytest.raises(AttributeError):
+        del m.i8
+
+    # Python subclasses use the fast path as well
+    class Sub(t.Members):
+        pass
+
+    s = Sub()
+    s.i8 = 5
+    assert s.i8 == 5 and s.base == 1
+
+    # Unusable instances and foreign objects go through the bound getter
+    u = t.Members.__new__(t.Members)
+    with pytest.warns(RuntimeWarning, match="access an uninitialized instance"):
+        with pytest.raises(TypeError):
+            u.i8
+    with pytest.warns(RuntimeWarning, match="access an uninitialized instance"):
+        with pytest.raises(TypeError):
+            u.i8 = 1
+    with pytest.raises(TypeError):
+        t.Members.__dict__["i8"].__get__(object())
+    with pytest.raises(TypeError):
+        t.Members.__dict__["i8"].__set__(object(), 1)
+
+
+def test68_member_descriptors_offset():
+    member = type(t.Members.__dict__["i8"])
+    for name in ("base", "base2", "i16"):
+        assert type(t.Members2.__dict__[name]) is member
+
+    class Sub(t.Members2):
+        pass
+
+    # The first access determines the field offsets, here via a subclass
+    # instance and the setter
+    s = Sub()
+    s.base2, s.i16, s.base = 4.5, -3, 9
+    m = t.Members2()
+    assert (m.base, m.base2, m.i16) == (1, 2.5, 7)
+    assert (s.base, s.base2, s.i16) == (9, 4.5, -3)
+
+    with pytest.raises(TypeError, match="incompatible function arguments"):
+        m.i16 = 2**15
+    assert m.i16 == 7
+
+    refs_before = sys.getrefcount(m)
+    for _ in range(10):
+        m.base2 = m.base2 + 1
+    assert m.base2 == 12.5
+    assert sys.getrefcount(m) == refs_before
+
+
+def test69_no_identity():
+    # Instances created by value are not tracked
+    c = t.Color()
+    c.r = 2
+    assert t.Color().r == 0 and c.r == 2
+    assert not t.color_find(c)
+
+    # References to C++ objects are still looked up
+    a, b = t.Color.shared, t.Color.shared
+    assert a is b and t.color_find(a)
+    del a, b
+
+    # The property is inherited by subclasses. A reference into an untracked
+    # instance creates a new wrapper.
+    e = t.ColorEx()
+    assert not t.color_find(e)
+    r = t.color_ex_ref(e)
+    assert r is not e and type(r) is t.ColorEx
+    assert t.color_ex_ref(e) is r
+    r.r = 3
+    assert e.r == 3
+    del r, e, c
+
+    # A pointer that is returned twice has a single owner
+    a = t.color_owned_new()
+    b = t.color_owned_get()
+    assert a is b
+    del a, b
+    collect()
+
+
+def test70_compact_instances():
+    a = t.Vec3f(1, 2, 3)
+    b = a + t.Vec3f(4, 5, 6)
+    assert (b.x, b.y, b.z) == (5, 7, 9)
+    b.z = 1.5
+    assert (a.z, b.z) == (3, 1.5)
+
+    # The data of compact instances overlaps the offset to external data
+    if not is_pypy:
+        assert sys.getsizeof(a) == sys.getsizeof(object()) + 16
+
+    # References to fields still use the regular layout
+    s = t.Segment()
+    s.a = a
+    ref = s.a
+    ref.y = 10
+    assert s.a.y == 10 and a.y == 2
+    assert (s.b.x, s.b.y, s.b.z) == (0, 0, 0)
+
+    # Python subclasses with a __dict__ are supported as well
+    class Sub(t.Vec3f):
+        pass
+
+    c = Sub(7, 8, 9)
+    c.name = "c"
+    assert (c.x, c.y, c.z, c.name) == (7, 8, 9, "c")
+    d = c + c
+    assert type(d) is t.Vec3f and d.z == 18
+
+
+@skip_on_pypy
+def test71_pool_stats():
+    s0 = t.pool_stats(t.Burst)
+    assert set(s0) == {"hits", "misses", "evictions", "grows", "shrinks",
+                       "capacity", "count"}
+
+    # Bursts exceeding the capacity cause misses and evictions: the pool grows
+    for _ in range(20):
+        items = [t.Burst(i) for i in range(64)]
+        del items
+    s1 = t.pool_stats(t.Burst)
+    assert s1["misses"] > s0["misses"]
+    assert s1["evictions"] > s0["evictions"]
+    assert s1["grows"] > s0["grows"]
+    assert s1["capacity"] > 4
+
+    # Steady single-object churn leaves most parked instances idle: it shrinks
+    for i in range(5000):
+        x = t.Burst(i)
+        del x
+    s2 = t.pool_stats(t.Burst)
+    assert s2["hits"] >= s1["hits"] + 5000
+    assert s2["shrinks"] > s1["shrinks"]
+    assert s2["capacity"] < s1["capacity"]
+    assert s2["count"] <= s2["capacity"]
+
+    # Unpooled types report zeros, other types are rejected
+    assert t.pool_stats(t.Vec3f)["capacity"] == 0
+    with pytest.raises(TypeError):
+        t.pool_stats(int)
+
+
+@skip_on_pypy
+def test71b_pool_idle():
+    # Grow the pool of 'Burst' and leave instances parked in it
+    for _ in range(20):
+        items = [t.Burst(i) for i in range(64)]
+        del items
+    s0 = t.pool_stats(t.Burst)
+    assert s0["capacity"] > 4 and s0["count"] > 1
+
+    # The pool shrinks while other pooled types are in use
+    for i in range(5000):
+        x = t.Pooled(i)
+        del x
+    s1 = t.pool_stats(t.Burst)
+    assert s1["hits"] == s0["hits"] and s1["misses"] == s0["misses"]
+    assert s1["shrinks"] > s0["shrinks"]
+    assert s1["capacity"] < s0["capacity"]
+    assert s1["count"] < s0["count"]
+
+
+def test72_late_binding():
+    # Failed lookups are not cached, so binding the type later takes effect
+    for _ in range(2):
+        with pytest.raises(TypeError):
+            t.late_get()
+
+    t.late_bind(t)
+    x = t.late_get()
+    assert type(x).__name__ == "Late"
+    for _ in range(2):
+        assert t.late_value(x) == 7
+        assert t.late_value(t.late_get()) == 7
+
+
+def test72b_type_unregister():
+    # Removing a type invalidates the records cached by its casters
+    import types
+    m = types.ModuleType("transient")
+    t.transient_bind(m)
+    tp = m.Transient
+    for _ in range(2):
+        assert type(t.transient_get()) is tp
+        assert t.transient_value(t.transient_get()) == 3
+
+    del m, tp
+    collect()
+    with pytest.raises(TypeError):
+        t.transient_get()
+
+    m = types.ModuleType("transient")
+    t.transient_bind(m)
+    assert type(t.transient_get()) is m.Transient
+    assert t.transient_value(t.transient_get()) == 3
+
+
+def test73_keep_alive_inline(clean):
+    import weakref
+
+    class Patient:
+        pass
+
+    # The wrapper 's1' references 's' through its inline keep-alive slot.
+    # Further patients are stored in the keep_alive map.
+    s = t.PairStruct()
+    s1 = s.s1
+    a, b = Patient(), Patient()
+    wa, wb = weakref.ref(a), weakref.ref(b)
+    assert t.keep_alive_ret(s1, a) is a
+    assert t.keep_alive_ret(s1, a) is a
+    assert t.keep_alive_ret(s1, b) is b
+    assert t.keep_alive_ret(s1, s) is s
+    del s, a, b
+    collect()
+
+    # The patients survive as long as the nurse
+    assert wa() is not None and wb() is not None
+    assert_stats(default_constructed=2)
+    assert s1.value() == 5
+    del s1
+    collect()
+    assert wa() is None and wb() is None
+    assert_stats(default_constructed=2, destructed=2)
@@ -726,4 +726,44 @@ NB_MODULE(test_functions_ext, m) {
 
     m.def("test_accessor_inplace_attr", [](nb::object o, nb::object v) { o.attr("x") += v; });
     m.def("test_accessor_inplace_item", [](nb::object o, nb::object v) { o["x"] += v; });
+
+    // Test the overload resolution cache. The same overload chain is bound
+    // with and without nb::cache_overloads() for comparison.
+    auto def_ov_chain = [&](const char *name, auto... extra) {
+        m.def(name, [](nb::bytes) { return "bytes"; }, extra...);
+        m.def(name, [](nb::list) { return "list"; }, extra...);
+        m.def(name, [](nb::dict) { return "dict"; }, extra...);
+        m.def(name, [](nb::tuple) { return "tuple"; }, extra...);
+        m.def(name, [](nb::set) { return "set"; }, extra...);
+        m.def(name, [](int) { return "int"; }, extra...);
+        m.def(name, [](double) { return "float"; }, extra...);
+        m.def(name, [](const std::string &) { return "str"; }, extra...);
+        m.def(name, [](int, const std::string &) { return "int,str"; },
+              "a"_a, "b"_a, extra...);
+    };
+    def_ov_chain("test_ov_chain");
+    def_ov_chain("test_ov_chain_cached", nb::cache_overloads());
+
+    m.def("test_ov_cache_value", [](uint8_t) { return "uint8"; },
+          nb::cache_overloads());
+    m.def("test_ov_cache_value", [](int64_t) { return "int64"; },
+          nb::cache_overloads());
+
+    m.def("test_ov_cache_error", [](uint8_t) { return "uint8"; },
+          nb::cache_overloads());
+    m.def("test_ov_cache_error", [](int64_t) -> const char * {
+              throw std::invalid_argument("value out of range");
+          }, nb::cache_overloads());
+
+    // Test keyword-heavy calls (precomputed keyword argument matching)
+    m.def("test_kw_plan",
+          [](int a, int b, int c, int d, int e, int f, int g, int h, int i,
+             int j) { return nb::make_tuple(a, b, c, d, e, f, g, h, i, j); },
+          "a"_a, "b"_a = 1, "c"_a = 2, "d"_a = 3, "e"_a = 4, "f"_a = 5,
+          "g"_a = 6, "h"_a = 7, "i"_a = 8, "j"_a = 9);
+    m.def("test_kw_plan",
+          [](const std::string &s, nb::args args, nb::kwargs kwargs) {
+              return nb::make_tuple(s, args, kwargs);
+          },
+          "s"_a, "args"_a, "kwargs"_a);
 }
@@ -1042,3 +1042,86 @@ def test_57_accessor_inplace_refleak():
         t.test_accessor_inplace_item(d, [1])
     assert sys.getrefcount(lst) == refs_before
     assert d["x"] == [1, 1, 1, 1, 1]
+
+
+def test_58_overload_cache():
+    args = [b"x", [1], {1: 2}, (1,), {1}, 1, 1.5, "x"]
+    expected = ["bytes", "list", "dict", "tuple", "set", "int", "float", "str"]
+
+    for _ in range(3):
+        for f in (t.test_ov_chain, t.test_ov_chain_cached):
+            assert [f(a) for a in args] == expected
+            assert f(1, "x") == "int,str"
+            assert f(1, b="x") == "int,str"
+            assert f(a=1, b="x") == "int,str"
+            assert f(b="x", a=1) == "int,str"
+            with pytest.raises(TypeError):
+                f(None)
+            with pytest.raises(TypeError):
+                f(a="x", b=1)
+
+    # Overloads chosen based on the argument values are not memoized
+    for _ in range(3):
+        assert t.test_ov_cache_value(1000) == "int64"
+        assert t.test_ov_cache_value(5) == "uint8"
+    with pytest.raises(TypeError):
+        t.test_ov_cache_value(2**70)
+
+    # Overloads that raised are not memoized
+    for _ in range(3):
+        with pytest.raises(ValueError, match="value out of range"):
+            t.test_ov_cache_error(1000)
+        assert t.test_ov_cache_error(5) == "uint8"
+
+
+def test_60_keyword_plans():
+    f = t.test_kw_plan
+    default = tuple(range(10))
+
+    for _ in range(3):
+        # More distinct keyword name combinations than plans per function
+        assert f(10, j=19) == (10,) + default[1:9] + (19,)
+        assert f(10, b=11, c=12) == (10, 11, 12) + default[3:]
+        assert f(c=12, b=11, a=10) == (10, 11, 12) + default[3:]
+        assert f(a=10, e=14) == (10, 1, 2, 3, 14) + default[5:]
+        assert f(10, 11, i=18, h=17) == (10, 11) + default[2:7] + (17, 18, 9)
+        assert f(10, d=13, f=15, g=16) == (10, 1, 2, 13, 4, 15, 16, 7, 8, 9)
+        assert f(**{"a": 10, "j": 19}) == (10,) + default[1:9] + (19,)
+
+        # Keyword arguments not accepted by the first overload
+        assert f("x", 1, y=2) == ("x", (1,), {"y": 2})
+        assert f(s="x", a=1) == ("x", (), {"a": 1})
+        assert f("x", args=1) == ("x", (), {"args": 1})
+
+        # Positional/keyword conflicts and unknown keywords
+        with pytest.raises(TypeError):
+            f(10, a=10)
+        with pytest.raises(TypeError):
+            f(10, z=10)
+        with pytest.raises(TypeError):
+            f("x", s="y")
+
+
+def test_61_keyword_plans_unpacked():
+    f = t.test_kw_plan
+    default = tuple(range(10))
+
+    # Dictionary unpacking builds a new name tuple for every call
+    for _ in range(3):
+        for i, name in enumerate("bcdefghij"):
+            expected = list(default)
+            expected[0], expected[i + 1] = 10, 20
+            assert f(**{"a": 10, name: 20}) == tuple(expected)
+
+    # Call sites with a constant name tuple still work afterwards
+    for _ in range(3):
+        assert f(10, j=19) == (10,) + default[1:9] + (19,)
+        assert f(c=12, b=11, a=10) == (10, 11, 12) + default[3:]
+
+    # Keyword argument values are not retained
+    o = object()
+    refs_before = sys.getrefcount(o)
+    for _ in range(10):
+        assert f("x", **{"o": o}) == ("x", (), {"o": o})
+        assert f("x", o=o) == ("x", (), {"o": o})
+    assert sys.getrefcount(o) == refs_before
@@ -62,6 +62,16 @@ def test03_reimport_module():
     assert new_t2.check_shared(s2, 124)
 
 
+def test04_inter_module_ndarray():
+    # Arrays are exchanged between extensions of different domains
+    import test_ndarray_ext as t4
+    a = t1.create_array()
+    for _ in range(2):
+        assert t4.flat_c_f32(a) == [1, 2, 3]
+        assert t4.get_shape(a) == [3]
+    del a
+
+
 def run():
     import sys
     if 'tests' not in sys.path[0]:
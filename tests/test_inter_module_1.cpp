@@ -1,8 +1,15 @@
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include "inter_module.h"
 
 namespace nb = nanobind;
 
 NB_MODULE(test_inter_module_1_ext, m) {
     m.def("create_shared", &create_shared);
+
+    // Arrays of this domain passed to extensions of other domains
+    m.def("create_array", []() {
+        static const float data[] = { 1, 2, 3 };
+        return nb::ndarray<nb::array_api, const float, nb::shape<3>>(data);
+    }, nb::rv_policy::reference);
 }
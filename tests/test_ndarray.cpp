@@ -1,6 +1,8 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
+#include <nanobind/stl/complex.h>
 #include <nanobind/stl/pair.h>
+#include <nanobind/stl/vector.h>
 #include <algorithm>
 #include <complex>
 #include <vector>
@@ -691,4 +693,185 @@ NB_MODULE(test_ndarray_ext, m) {
         return nb::ndarray<nb::numpy, float, nb::shape<-1>>(data, {n}, capsule);
     });
 
+    // Zero-copy return of a std::vector
+    m.def("ret_as_ndarray_memview", [](size_t n) {
+        std::vector<int16_t> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = (int16_t) i;
+        return nb::as_ndarray<nb::memview>(std::move(v));
+    });
+
+    m.def("ret_as_ndarray_numpy", [](size_t n) {
+        return nb::as_ndarray(std::vector<double>(n, 1.5));
+    });
+
+    // Native dtype/order conversion of CPU arrays
+    m.def("ret_f_order_memview", []() {
+        static double data[] = { 1, 2, 3, 4, 5, 6 };
+        return nb::ndarray<nb::memview, double, nb::shape<2, 3>, nb::f_contig>(
+            data);
+    }, nb::rv_policy::reference);
+
+    m.def("flat_c_f32",
+          [](nb::ndarray<const float, nb::c_contig, nb::device::cpu> a) {
+              return std::vector<float>(a.data(), a.data() + a.size());
+          });
+
+    m.def("flat_f_i64",
+          [](nb::ndarray<const int64_t, nb::f_contig, nb::device::cpu> a) {
+              return std::vector<int64_t>(a.data(), a.data() + a.size());
+          });
+
+    m.def("flat_c_c128",
+          [](nb::ndarray<const std::complex<double>, nb::c_contig,
+                         nb::device::cpu> a) {
+              return std::vector<std::complex<double>>(a.data(),
+                                                       a.data() + a.size());
+          });
+
+    m.def("checksum_f_i64",
+          [](nb::ndarray<const int64_t, nb::f_contig, nb::device::cpu> a) {
+              uint64_t sum = 0;
+              for (size_t i = 0; i < a.size(); ++i)
+                  sum += (uint64_t) (i + 1) * (uint64_t) a.data()[i];
+              return sum;
+          });
+
+    m.def("set_copy_config", [](uint32_t threads, uint32_t threshold) {
+        nb::set_ndarray_copy_threads(threads);
+        nb::set_ndarray_copy_threshold(threshold);
+    });
+
+    m.def("copy_config", []() {
+        return std::make_pair(nb::ndarray_copy_threads(),
+                              nb::ndarray_copy_threshold());
+    });
+
+    struct Buffer {
+        float data[4] { 1, 2, 3, 4 };
+    };
+
+    nb::class_<Buffer>(m, "Buffer")
+        .def(nb::init<>())
+        .def("view", [](Buffer &b) {
+            return nb::ndarray<nb::memview, float, nb::shape<4>>(b.data);
+        }, nb::rv_policy::reference_internal)
+        .def("view_ro", [](Buffer &b) {
+            return nb::ndarray<nb::memview, const float, nb::shape<4>>(b.data);
+        }, nb::rv_policy::reference_internal)
+        .def("view_np", [](Buffer &b) {
+            return nb::ndarray<nb::numpy, float, nb::shape<4>>(b.data);
+        }, nb::rv_policy::reference_internal);
+
+    m.def("set_export_cache", &nb::set_ndarray_export_cache);
+    m.def("export_cache", &nb::ndarray_export_cache);
+
+    nb::enum_<nb::mmap_mode>(m, "MMapMode")
+        .value("read_only", nb::mmap_mode::read_only)
+        .value("read_write", nb::mmap_mode::read_write)
+        .value("copy_on_write", nb::mmap_mode::copy_on_write);
+
+    m.def("mmap_ro", [](const char *path, size_t n, uint64_t offset) {
+        return nb::ndarray_mmap<nb::memview, const float, nb::ndim<1>>(
+            path, { n }, offset);
+    });
+
+    m.def("mmap_rw", [](int fd, size_t rows, size_t cols, nb::mmap_mode mode) {
+        return nb::ndarray_mmap<nb::memview, int32_t, nb::ndim<2>>(
+            fd, { rows, cols }, 0, mode);
+    });
+
+    m.def("alloc_f32", [](size_t n, size_t alignment, bool huge_pages) {
+        auto a = nb::ndarray_alloc<nb::memview, float, nb::ndim<1>>(
+            { n }, alignment,
+            huge_pages ? nb::alloc_flags::huge_pages : nb::alloc_flags::none);
+        for (size_t i = 0; i < n; ++i)
+            a(i) = (float) i;
+        return a;
+    });
+
+    m.def("alloc_address", [](nb::ndarray<nb::ro, nb::device::cpu> a) {
+        return (uintptr_t) a.data();
+    });
+
+    // Point cloud centroids through views with run-time and compile-time
+    // strides. 'repeat' permits timing the two variants against each other.
+    m.def("centroid_dynamic", [](nb::ndarray<const float, nb::ndim<2>, nb::device::cpu> x,
+                                 size_t repeat) {
+        auto v = x.view();
+        float c[3] { };
+        for (size_t r = 0; r < repeat; ++r)
+            for (size_t i = 0; i < v.shape(0); ++i)
+                for (size_t j = 0; j < 3; ++j)
+                    c[j] += v(i, j);
+        return std::vector<float>(c, c + 3);
+    });
+
+    m.def("centroid_static", [](nb::ndarray<const float, nb::shape<-1, 3>, nb::c_contig,
+                                            nb::device::cpu> x,
+                                size_t repeat) {
+        auto v = x.view();
+        float c[3] { };
+        for (size_t r = 0; r < repeat; ++r)
+            for (size_t i = 0; i < v.shape(0); ++i)
+                for (size_t j = 0; j < v.shape(1); ++j)
+                    c[j] += v(i, j);
+        return std::vector<float>(c, c + 3);
+    });
+
+    m.def("view_sum_flat", [](nb::ndarray<const float, nb::ndim<2>, nb::c_contig,
+                                          nb::device::cpu> x) {
+        auto v = x.view();
+        float sum = 0.f;
+        for (float f : v)
+            sum += f;
+        return std::make_pair(sum, v.size());
+    });
+
+    using Vec1 = nb::ndarray<const float, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+    using Vec3 = nb::ndarray<const float, nb::shape<-1, 3>, nb::c_contig, nb::device::cpu>;
+
+    m.def("axpy_points", [](float a, Vec3 x, Vec3 y, Vec1 w) {
+        auto xv = x.view(), yv = y.view();
+        float sum = 0.f;
+        for (size_t i = 0; i < xv.shape(0); ++i)
+            for (size_t j = 0; j < 3; ++j)
+                sum += (a * xv(i, j) + yv(i, j)) * (w.is_valid() ? w(i) : 1.f);
+        return sum;
+    }, "a"_a, "x"_a, "y"_a, "w"_a = nb::none(), nb::same_extent<0, 2, 3, 4>());
+
+    m.def("sum_pair", [](Vec1 x, nb::ndarray<const double, nb::ndim<1>, nb::device::cpu> y) {
+        double sum = 0;
+        for (size_t i = 0; i < x.shape(0); ++i)
+            sum += x(i);
+        for (size_t i = 0; i < y.shape(0); ++i)
+            sum += y(i);
+        return sum;
+    });
+
+    m.def("alloc_array_api", [](size_t n) {
+        auto a = nb::ndarray_alloc<nb::array_api, float, nb::ndim<1>>({ n });
+        for (size_t i = 0; i < n; ++i)
+            a(i) = (float) i;
+        return a;
+    });
+
+    m.def("same_handle", [](nb::ndarray<float, nb::ndim<1>, nb::device::cpu> a,
+                            nb::ndarray<float, nb::ndim<1>, nb::device::cpu> b) {
+        return a.handle() == b.handle();
+    });
+
+    m.def("as_memview_ro", [](nb::ndarray<const float, nb::ndim<1>, nb::device::cpu> a) {
+        return nb::ndarray<nb::memview, const float, nb::ndim<1>>(a);
+    });
+
+    m.def("flat_c_bool",
+          [](nb::ndarray<const bool, nb::c_contig, nb::device::cpu> a) {
+              return std::vector<bool>(a.data(), a.data() + a.size());
+          });
+
+    m.def("flat_c_u8",
+          [](nb::ndarray<const uint8_t, nb::c_contig, nb::device::cpu> a) {
+              return std::vector<uint8_t>(a.data(), a.data() + a.size());
+          });
 }
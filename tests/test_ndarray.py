@@ -1,5 +1,6 @@
 import test_ndarray_ext as t
 import pytest
+import sys
 import warnings
 import importlib
 from common import collect, skip_on_pypy
@@ -1263,3 +1264,290 @@ def test55_empty_ndarray():
     arr = t.ret_ndarray_empty()
     assert arr.shape == (0,)
     assert arr.dtype == np.float32
+
+
+def test56_as_ndarray():
+    m = t.ret_as_ndarray_memview(5)
+    assert m.format == 'h' and m.shape == (5,)
+    assert m.tolist() == [0, 1, 2, 3, 4]
+    assert t.ret_as_ndarray_memview(0).tolist() == []
+    del m
+    collect()
+
+
+@needs_numpy
+def test57_as_ndarray_numpy():
+    a = t.ret_as_ndarray_numpy(3)
+    assert a.dtype == np.float64 and a.shape == (3,)
+    assert np.all(a == 1.5)
+
+
+def test58_type_cache():
+    import array
+    class Wrapper:
+        pass
+
+    w = Wrapper()
+    for _ in range(3):
+        assert not t.check(w)
+
+    # Modifying the type must invalidate cached properties
+    Wrapper.__dlpack__ = lambda self, **kwargs: None
+    assert t.check(w)
+    del Wrapper.__dlpack__
+    assert not t.check(w)
+
+    a = array.array('f', [1, 2, 3])
+    for _ in range(3):
+        assert t.check(a)
+        assert t.get_shape(a) == [3]
+
+
+def test59_native_conversion():
+    import array
+    a = array.array('d', [1.5, 2.5, -3.5, 4.0])
+
+    # dtype conversion of a contiguous and a strided buffer
+    assert t.flat_c_f32(a) == [1.5, 2.5, -3.5, 4.0]
+    assert t.flat_c_f32(memoryview(a)[::2]) == [1.5, -3.5]
+    assert t.flat_f_i64(a) == [1, 2, -3, 4]
+    assert t.flat_c_c128(a) == [1.5, 2.5, -3.5, 4.0]
+    assert t.flat_c_bool(array.array('i', [0, 1, -2])) == [False, True, True]
+    assert t.flat_c_f32(array.array('f')) == []
+
+    # A zero-dimensional array
+    assert t.flat_c_f32(memoryview(array.array('q', [7])).cast('B').cast('q', [])) == [7.0]
+
+    # Conversion to the required memory order
+    f = t.ret_f_order_memview()
+    assert f.f_contiguous and not f.c_contiguous
+    assert f.tolist() == [[1, 3, 5], [2, 4, 6]]
+    assert t.flat_c_f32(f) == [1, 3, 5, 2, 4, 6]
+    assert t.flat_f_i64(f) == [1, 2, 3, 4, 5, 6]
+    m = memoryview(array.array('q', range(6))).cast('B').cast('q', [2, 3])
+    assert t.flat_f_i64(m) == [0, 3, 1, 4, 2, 5]
+
+    with pytest.raises(TypeError):
+        t.noimplicit(memoryview(a).cast('B').cast('d', [2, 2]))
+    assert t.implicit(memoryview(a).cast('B').cast('d', [2, 2])) == 0
+
+
+def test60_handle_pool():
+    # Exercise each size class of the ndarray handle allocator
+    import array
+    a = array.array('d', [1, 2, 3, 4])
+    for ndim in (1, 6, 10):
+        m = memoryview(a).cast('B').cast('d', [1] * (ndim - 1) + [4])
+        for _ in range(200):
+            assert t.flat_c_f32(m) == [1, 2, 3, 4]
+            assert t.get_shape(m) == [1] * (ndim - 1) + [4]
+
+
+def test61_parallel_conversion():
+    import array
+    a = array.array('f', range(1 << 18))
+    m = memoryview(a).cast('B').cast('f', [512, 512])
+
+    # Expected checksum of the Fortran-ordered copy
+    expected = 0
+    for i, v in enumerate(v for col in range(512) for v in a[col::512]):
+        expected += (i + 1) * int(v)
+    expected %= 1 << 64
+
+    config = t.copy_config()
+    try:
+        for threads in (1, 3, 8):
+            t.set_copy_config(threads, 0)
+            assert t.copy_config() == (threads, 0)
+            assert t.checksum_f_i64(m) == expected
+            assert t.flat_c_f32(memoryview(a)[1::2])[-2:] == [(1 << 18) - 3, (1 << 18) - 1]
+    finally:
+        t.set_copy_config(*config)
+
+
+def test62_export_cache():
+    b = t.Buffer()
+    assert not t.export_cache()
+    assert b.view() is not b.view()
+
+    t.set_export_cache(True)
+    try:
+        v1 = b.view()
+        assert v1.tolist() == [1, 2, 3, 4]
+        assert b.view() is v1
+        assert b.view_ro() is not v1 and b.view_ro().readonly
+        assert t.Buffer().view() is not v1
+
+        # The cache only holds weak references
+        del v1
+        collect()
+        v2 = b.view()
+        assert v2.tolist() == [1, 2, 3, 4]
+        del b
+        collect()
+        assert v2.tolist() == [1, 2, 3, 4]
+
+        # Objects invalidated by the caller aren't returned again
+        b = t.Buffer()
+        v = b.view()
+        v.release()
+        assert b.view().tolist() == [1, 2, 3, 4]
+    finally:
+        t.set_export_cache(False)
+
+
+@needs_numpy
+def test62b_export_cache_numpy():
+    b = t.Buffer()
+    t.set_export_cache(True)
+    try:
+        a = b.view_np()
+        assert b.view_np() is a
+        a.shape = (2, 2)
+        assert b.view_np() is not a and b.view_np().shape == (4,)
+        a = b.view_np()
+        a.flags.writeable = False
+        assert b.view_np() is not a and b.view_np().flags.writeable
+    finally:
+        t.set_export_cache(False)
+
+
+def test63_mmap(tmp_path):
+    import array, os
+    path = tmp_path / 'data.bin'
+    path.write_bytes(array.array('f', range(1000)).tobytes())
+
+    m = t.mmap_ro(str(path), 10, 4000 - 40)
+    assert m.readonly and m.tolist() == list(range(990, 1000))
+    m = t.mmap_ro(str(path), 4, 4)
+    assert m.tolist() == [1, 2, 3, 4]
+    assert t.mmap_ro(str(path), 0, 4000).tolist() == []
+    del m
+
+    with pytest.raises(ValueError, match='too small'):
+        t.mmap_ro(str(path), 1001, 0)
+    with pytest.raises(ValueError, match='exceeds the address space'):
+        t.mmap_ro(str(path), sys.maxsize, 0)
+    with pytest.raises(ValueError, match='exceeds the address space'):
+        t.mmap_ro(str(path), 10, 2**64 - 8)
+    with pytest.raises(OSError):
+        t.mmap_ro(str(tmp_path / 'missing.bin'), 1, 0)
+
+    path = tmp_path / 'data2.bin'
+    path.write_bytes(array.array('i', range(6)).tobytes())
+
+    with open(path, 'r+b') as f:
+        m = t.mmap_rw(f.fileno(), 2, 3, t.MMapMode.copy_on_write)
+        m2 = t.mmap_rw(f.fileno(), 2, 3, t.MMapMode.read_write)
+    assert m.tolist() == [[0, 1, 2], [3, 4, 5]]
+    m[1, 1] = 40
+    assert m.tolist() == [[0, 1, 2], [3, 40, 5]]
+    m2[0, 0] = 10
+    del m, m2
+    collect()
+    assert array.array('i', path.read_bytes()).tolist() == [10, 1, 2, 3, 4, 5]
+
+    with open(path, 'rb') as f:
+        with pytest.raises(ValueError, match='writable array'):
+            t.mmap_rw(f.fileno(), 2, 3, t.MMapMode.read_only)
+
+
+def test64_alloc():
+    for n, alignment in ((0, 64), (5, 8), (1000, 64), (3000, 4096),
+                         (300000, 128)):
+        a = t.alloc_f32(n, alignment, False)
+        assert a.tolist() == list(range(n))
+        assert t.alloc_address(a) % alignment == 0
+
+    a = t.alloc_f32(1 << 20, 64, True)
+    assert t.alloc_address(a) % (2 << 20) == 0
+    assert a[12345] == 12345
+    del a
+
+    # Blocks of the same size class are recycled
+    a = t.alloc_f32(100, 64, False)
+    addr = t.alloc_address(a)
+    del a
+    collect()
+    assert t.alloc_address(t.alloc_f32(120, 64, False)) == addr
+
+    with pytest.raises(ValueError, match='power of two'):
+        t.alloc_f32(10, 48, False)
+
+    # Sizes that don't fit into the address space
+    with pytest.raises(ValueError, match='exceeds the address space'):
+        t.alloc_f32(sys.maxsize, 64, False)
+    with pytest.raises(MemoryError):
+        t.alloc_f32(sys.maxsize // 2, 64, True)
+
+
+def test65_view_static_layout():
+    import array
+    n = 1000
+    data = memoryview(array.array('f', range(3 * n))).cast('B').cast('f', (n, 3))
+    expected = [float(sum(range(j, 3 * n, 3))) for j in range(3)]
+
+    assert t.centroid_dynamic(data, 1) == expected
+    assert t.centroid_static(data, 1) == expected
+    assert t.centroid_static(data, 2) == [2 * e for e in expected]
+    assert t.view_sum_flat(data) == (float(sum(range(3 * n))), 3 * n)
+
+    with pytest.raises(TypeError):
+        t.centroid_static(memoryview(array.array('f', range(8))).cast('B').cast('f', (2, 4)), 1)
+
+
+def test66_batch_import():
+    import array, sys
+    def points(*v):
+        return memoryview(array.array('f', v)).cast('B').cast('f', (len(v) // 3, 3))
+
+    x = points(1, 2, 3, 4, 5, 6)
+    y = points(1, 1, 1, 1, 1, 1)
+    assert t.axpy_points(2, x, y) == 48
+    assert t.axpy_points(2, x, y, memoryview(array.array('f', [1, 0]))) == 15
+
+    # Mismatched lengths along axis 0
+    rc = sys.getrefcount(x)
+    with pytest.raises(TypeError):
+        t.axpy_points(2, x, points(1, 1, 1))
+    with pytest.raises(TypeError):
+        t.axpy_points(2, x, y, memoryview(array.array('f', [1, 0, 0])))
+    assert sys.getrefcount(x) == rc
+
+    # Arrays are converted as usual (the second one to float64)
+    assert t.sum_pair(array.array('f', [1, 2]), array.array('i', [3, 4])) == 10
+    with pytest.raises(TypeError):
+        t.sum_pair(array.array('f', [1, 2]), [3, 4])
+
+
+def test67_import_nb_ndarray():
+    a = t.alloc_array_api(5)
+    assert type(a).__name__ == 'nb_ndarray'
+
+    # Arrays created by nanobind share their handle when passed back
+    assert t.same_handle(a, a)
+    assert t.alloc_address(a) == t.alloc_address(t.as_memview_ro(a))
+
+    # ... and respect the read-only status of the parameter
+    m = t.as_memview_ro(a)
+    assert m.readonly and m.tolist() == [0, 1, 2, 3, 4]
+    del a
+    collect()
+    assert m.tolist() == [0, 1, 2, 3, 4]
+
+    # Conversions still take the general path
+    assert t.checksum_f_i64(t.alloc_array_api(4)) == 20
+
+
+@needs_numpy
+def test68_native_conversion_limits():
+    # Values that the target type cannot represent saturate
+    x = np.array([np.nan, np.inf, -np.inf, 1e300, -1e300, 300.7, -5.5,
+                  2.0**63, -2.0**63])
+    i64_max, i64_min = 2**63 - 1, -2**63
+    assert t.flat_f_i64(x) == [0, i64_max, i64_min, i64_max, i64_min, 300, -5,
+                               i64_max, i64_min]
+    assert t.flat_c_u8(x) == [0, 255, 0, 255, 0, 255, 0, 255, 0]
+    y = t.flat_c_f32(np.array([1e300, -1e300, np.nan, 1.5]))
+    assert y[:2] == [float("inf"), float("-inf")] and y[2] != y[2]
+    assert y[3] == 1.5
@@ -47,6 +47,26 @@ struct Copyable {
     ~Copyable() { destructed++; }
 };
 
+struct PooledValue {
+    int value = 0;
+};
+
+struct ThrowingCopy {
+    static int copies_left, alive;
+    int value = 0;
+
+    ThrowingCopy(int value) : value(value) { alive++; }
+    ThrowingCopy(const ThrowingCopy &s) : value(s.value) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("ThrowingCopy: copy failed");
+        alive++;
+    }
+    ~ThrowingCopy() { alive--; }
+};
+
+int ThrowingCopy::copies_left = -1;
+int ThrowingCopy::alive = 0;
+
 struct NonAssignable {
   int value = 5;
 
@@ -586,4 +606,53 @@ NB_MODULE(test_stl_ext, m) {
             result += k + "=" + std::to_string(v) + ";";
         return result;
     });
+
+    // test77-78: batched instance creation when returning std::vector<T>
+    nb::class_<PooledValue>(m, "PooledValue", nb::pooled(4))
+        .def_rw("value", &PooledValue::value);
+
+    m.def("vec_return_pooled", [](int n) {
+        std::vector<PooledValue> x((size_t) n);
+        for (int i = 0; i < n; ++i)
+            x[(size_t) i].value = i;
+        return x;
+    });
+
+    m.def("vec_return_copyable_ref",
+          [](const std::vector<Copyable> &x) -> const std::vector<Copyable> & {
+              return x;
+          });
+
+    // The copy constructor throws after 'fail_at' successful copies
+    nb::class_<ThrowingCopy>(m, "ThrowingCopy")
+        .def_rw("value", &ThrowingCopy::value);
+
+    m.def("vec_return_throwing_copy",
+          [](int n, int fail_at) -> const std::vector<ThrowingCopy> & {
+              static std::vector<ThrowingCopy> x;
+              ThrowingCopy::copies_left = -1;
+              x.clear();
+              x.reserve((size_t) n);
+              for (int i = 0; i < n; ++i)
+                  x.emplace_back(i);
+              ThrowingCopy::copies_left = fail_at;
+              return x;
+          });
+
+    m.def("throwing_copy_alive", []() { return ThrowingCopy::alive; });
+
+    // test79-80: bulk conversion of sequences into vectors of scalars
+    m.def("vec_i8_in", [](std::vector<int8_t> x) { return x; });
+    m.def("vec_u32_in", [](std::vector<uint32_t> x) { return x; });
+    m.def("vec_i64_in", [](std::vector<int64_t> x) { return x; });
+    m.def("vec_f64_in", [](std::vector<double> x) { return x; });
+    m.def("vec_f64_in_noconvert", [](std::vector<double> x) { return x; },
+          nb::arg("x").noconvert());
+    m.def("vec_ld_in", [](std::vector<long double> x) { return x; });
+    m.def("array_f32_in", [](std::array<float, 3> x) { return x; });
+
+    m.def("array_i64_in", [](std::array<int64_t, 3> x) { return x; });
+
+    // test81: bulk conversion of vectors of scalars into lists
+    m.def("vec_u64_in", [](std::vector<uint64_t> x) { return x; });
 }
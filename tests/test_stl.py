@@ -1,4 +1,5 @@
 import test_stl_ext as t
+import sys
 import typing
 import pytest
 from common import collect, skip_on_pypy
@@ -971,3 +972,166 @@ def test76_map_from_other_mappings():
     for arg in (None, 5, [("a", 1)]):
         with pytest.raises(TypeError, match="incompatible function arguments"):
             t.map_str_int_in(arg)
+
+
+@skip_on_pypy
+def test77_vec_return_batched(clean):
+    x = t.vec_return_pooled(10)
+    assert type(x) is list and len({id(v) for v in x}) == 10
+    assert [v.value for v in x] == list(range(10))
+
+    # Released instances are parked in the pool (capacity 4) and reused in bulk
+    ids = {id(v) for v in x}
+    del x
+    x = t.vec_return_pooled(10)
+    assert [v.value for v in x] == list(range(10))
+    assert len(ids & {id(v) for v in x}) >= 4
+    x[3].value = 5
+    assert x[3].value == 5 and x[4].value == 4
+    assert t.vec_return_pooled(0) == []
+    del x
+
+    # References to a vector are copied into independent instances
+    src = [t.Copyable(i) for i in range(10)]
+    x = t.vec_return_copyable_ref(src)
+    assert [v.value for v in x] == list(range(10))
+    assert all(a is not b for a, b in zip(src, x))
+    x[0].value = 10
+    assert src[0].value == 0
+    del src, x
+    assert_stats(value_constructed=10, copy_constructed=20, destructed=30)
+
+
+def test78_vec_return_batched_copy_error():
+    # A failing copy releases the instances created so far exactly once
+    for _ in range(100):
+        for fail_at in (0, 2, 4):
+            with pytest.raises(TypeError, match="Unable to convert function return value"):
+                t.vec_return_throwing_copy(5, fail_at)
+    collect()
+    assert t.throwing_copy_alive() == 5
+
+    x = t.vec_return_throwing_copy(5, 5)
+    assert [v.value for v in x] == list(range(5))
+    assert t.throwing_copy_alive() == 10
+    del x
+    collect()
+    assert t.throwing_copy_alive() == 5
+
+
+def test79_vec_scalar_in():
+    assert t.vec_i8_in([1, -2, 127, -128]) == [1, -2, 127, -128]
+    assert t.vec_i8_in(()) == []
+    assert t.vec_u32_in((0, 1, 2**32 - 1)) == [0, 1, 2**32 - 1]
+    assert t.vec_i64_in([2**63 - 1, -2**63, True]) == [2**63 - 1, -2**63, 1]
+    assert t.vec_f64_in([1.5, 2, -3.25]) == [1.5, 2.0, -3.25]
+    assert t.vec_ld_in([0.5, 1]) == [0.5, 1.0]
+    assert t.vec_f64_in_noconvert([0.5, 1.0]) == [0.5, 1.0]
+    assert t.array_f32_in([1, 2.5, 3]) == [1.0, 2.5, 3.0]
+    assert t.array_f32_in((0.1, 0.2, 0.3))[0] == pytest.approx(0.1)
+
+    class Index:
+        def __index__(self):
+            return 5
+
+    assert t.vec_u32_in([1, Index()]) == [1, 5]
+
+    # A failing element anywhere rejects the entire sequence
+    for f, arg in ((t.vec_i8_in, [1, 128]), (t.vec_i8_in, [1, 2, "3"]),
+                   (t.vec_u32_in, [-1]), (t.vec_i64_in, [1, 2**63]),
+                   (t.vec_f64_in, [1.0, "2"]), (t.array_f32_in, [1, 2, None]),
+                   (t.vec_f64_in_noconvert, [0.5, 1]),
+                   (t.array_f32_in, [1, 2, "3"])):
+        with pytest.raises(TypeError, match="incompatible function arguments"):
+            f(arg)
+
+    class BadIndex:
+        def __index__(self):
+            raise RuntimeError("BadIndex")
+
+    with pytest.raises(TypeError, match="incompatible function arguments"):
+        t.vec_u32_in([1, BadIndex()])
+
+    # Long sequences leave the reference counts of their elements unchanged,
+    # also when an element fails to convert
+    x = [2**40 + i for i in range(1000)]
+    refs = [sys.getrefcount(v) for v in x]
+    assert t.vec_i64_in(x) == x
+    assert t.vec_i64_in(tuple(x)) == x
+    assert t.vec_f64_in(x) == [float(v) for v in x]
+    with pytest.raises(TypeError, match="incompatible function arguments"):
+        t.vec_u32_in(x)
+    assert [sys.getrefcount(v) for v in x] == refs
+
+
+def test80_vec_scalar_in_buffer():
+    import array
+
+    # Objects implementing the buffer protocol are copied directly
+    assert t.vec_f64_in(array.array('d', [1, 2.5])) == [1.0, 2.5]
+    assert t.vec_f64_in(array.array('i', [1, -2])) == [1.0, -2.0]
+    assert t.vec_f64_in(array.array('d')) == []
+    assert t.vec_i8_in(array.array('h', [1, -2])) == [1, -2]
+    assert t.vec_i8_in(bytearray(b'\x01\x02')) == [1, 2]
+    assert t.vec_u32_in(array.array('Q', [2**32 - 1])) == [2**32 - 1]
+    assert t.array_f32_in(array.array('f', [1, 2, 3])) == [1.0, 2.0, 3.0]
+    assert t.array_i64_in(array.array('b', [-1, 0, 1])) == [-1, 0, 1]
+
+    # Strided buffers
+    m = memoryview(array.array('q', range(10)))
+    assert t.vec_i64_in(m[::3]) == [0, 3, 6, 9]
+    assert t.vec_i64_in(m[::-4]) == [9, 5, 1]
+
+    # Lossy conversions are rejected like with the scalar casters
+    for f, arg in ((t.vec_i8_in, array.array('h', [1, 300])),
+                   (t.vec_u32_in, array.array('i', [-1])),
+                   (t.vec_i64_in, array.array('d', [1.0])),
+                   (t.array_f32_in, array.array('f', [1, 2])),
+                   (t.vec_i8_in, b'\x01\x02'),
+                   (t.vec_f64_in_noconvert, array.array('i', [1]))):
+        with pytest.raises(TypeError, match="incompatible function arguments"):
+            f(arg)
+
+    # The buffer is released after successful and failed conversions
+    b = bytearray(b'\x01\x02')
+    a = array.array('h', [1, 300])
+    refs = sys.getrefcount(a)
+    assert t.vec_i8_in(b) == [1, 2]
+    with pytest.raises(TypeError, match="incompatible function arguments"):
+        t.vec_i8_in(a)
+    b.append(3)
+    a.append(4)
+    assert sys.getrefcount(a) == refs
+
+    try:
+        import numpy as np
+    except ImportError:
+        return
+
+    assert t.vec_f64_in(np.arange(4, dtype=np.float32)) == [0, 1, 2, 3]
+    assert t.vec_i8_in(np.arange(8, dtype=np.int64)[::2]) == [0, 2, 4, 6]
+    assert t.array_i64_in(np.array([True, False, True])) == [1, 0, 1]
+    with pytest.raises(TypeError):
+        t.vec_u32_in(np.array([-1, 1]))
+
+
+def test81_vec_scalar_out():
+    assert t.vec_i8_in([1, -2, 127, -128]) == [1, -2, 127, -128]
+    assert t.vec_u32_in([2**32 - 1]) == [2**32 - 1]
+    assert t.vec_i64_in([-2**63, 2**63 - 1]) == [-2**63, 2**63 - 1]
+    assert t.vec_f64_in([0.25, -1e300]) == [0.25, -1e300]
+    assert t.vec_ld_in([0.5]) == [0.5]
+    x = t.array_f32_in([0.5, 1, 2])
+    assert type(x) is list and x == [0.5, 1.0, 2.0]
+    assert type(t.vec_f64_in([])) is list
+    assert t.array_out() == [1, 2, 3]
+
+    # Long vectors, including values outside of the small integer cache
+    x = list(range(-1000, 1000))
+    assert t.vec_i64_in(x) == x
+    x = [2**64 - 1 - i for i in range(1000)]
+    assert t.vec_u64_in(x) == x
+    x = t.vec_f64_in([float("inf"), float("-inf"), float("nan"), 1e-310])
+    assert x[:2] == [float("inf"), float("-inf")]
+    assert x[2] != x[2] and x[3] == 1e-310
+    assert all(type(v) is float for v in x)
@@ -3,6 +3,8 @@
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/bind_map.h>
 #include <nanobind/stl/bind_vector.h>
+#include <nanobind/ndarray.h>
+#include <nanobind/trampoline.h>
 
 #include <map>
 #include <memory>
@@ -46,6 +48,31 @@ struct AnInt {
     AnInt(int v) : value(v) {}
 };
 
+// Benchmark types (see bench_thread.py). nanobind identifies C++ types across
+// extensions by name, so these must not reuse type names of other test modules.
+struct ThreadBenchPooled {
+    int value;
+    ThreadBenchPooled(int v) : value(v) { }
+};
+
+struct BenchChild { int value = 0; };
+struct BenchParent { int value = 0; BenchChild child; };
+
+struct BenchBase {
+    virtual ~BenchBase() = default;
+    virtual int value() const { return 0; }
+};
+
+struct PyBenchBase : BenchBase {
+    NB_TRAMPOLINE(BenchBase);
+    int value() const override { NB_OVERRIDE(value); }
+};
+
+struct BenchScalar {
+    double value;
+    BenchScalar(double v) : value(v) { }
+};
+
 
 NB_MODULE(test_thread_ext, m) {
     nb::class_<Counter>(m, "Counter")
@@ -98,4 +125,39 @@ NB_MODULE(test_thread_ext, m) {
 
     nb::bind_vector<std::vector<int64_t>>(m, "IntVector");
     nb::bind_map<std::map<std::string, int64_t>>(m, "StringIntMap");
+
+    m.def("shard_stats", []() { return nb::shard_stats(); });
+    m.def("set_shard_stats_enabled", &nb::set_shard_stats_enabled);
+    m.def("shard_stats_enabled", &nb::shard_stats_enabled);
+
+    // Hot paths measured by bench_thread.py
+    m.def("bench_noop", [](int a, int b) { return a + b; });
+
+    nb::class_<ThreadBenchPooled>(m, "BenchPooled", nb::pooled(128))
+        .def(nb::init<int>());
+
+    m.def("bench_return_ref", [](Counter *c) { return c; },
+          nb::rv_policy::reference);
+
+    nb::class_<BenchChild>(m, "BenchChild")
+        .def_rw("value", &BenchChild::value);
+
+    nb::class_<BenchParent>(m, "BenchParent")
+        .def(nb::init<>())
+        .def_rw("child", &BenchParent::child);
+
+    nb::class_<BenchBase, PyBenchBase>(m, "BenchBase")
+        .def(nb::init<>())
+        .def("value", &BenchBase::value);
+
+    m.def("bench_call_virtual", [](const BenchBase &b) { return b.value(); });
+
+    m.def("bench_ndarray",
+          [](nb::ndarray<const float, nb::ndim<1>, nb::c_contig,
+                         nb::device::cpu> a) { return a.shape(0); });
+
+    nb::class_<BenchScalar>(m, "BenchScalar")
+        .def(nb::init_implicit<double>());
+
+    m.def("bench_implicit", [](const BenchScalar &s) { return s.value; });
 }
@@ -1,4 +1,8 @@
+import os
 import random
+import subprocess
+import sys
+import sysconfig
 import threading
 
 import pytest
@@ -251,3 +255,98 @@ def test15_bind_map_iter_threaded(n_threads=8):
 
     parallelize(f, n_threads=n_threads)
     assert len(m) == n
+
+
+def test16_inst_c2p_scaling(request):
+    # Scaling benchmark of the 'inst_c2p' lookup performed when returning an
+    # already registered instance (see bench_thread.py). Slow tests only.
+    if not request.config.getoption('enable-slow-tests'):
+        pytest.skip("skipping because slow tests are not enabled")
+
+    import bench_thread
+    result = bench_thread.run([1, 2, 4, 8], 0.1, names=["inst_c2p"])
+    rates = result["benchmarks"]["inst_c2p"]["calls_per_second"]
+    assert len(rates) == 4 and all(r > 0 for r in rates.values())
+
+
+def test17_inst_c2p_lookup_churn(n_threads=8):
+    # Lookups racing with registrations and removals in the same shard. The
+    # latter move entries of the table, which the unlocked lookup in
+    # free-threaded builds must tolerate.
+    n = 20000
+    def f():
+        keep = [Counter() for _ in range(16)]
+        for i in range(n):
+            tmp = [Counter() for _ in range(4)]
+            c = keep[i & 15]
+            assert t.return_self(c) is c
+            assert t.return_self(tmp[i & 3]) is tmp[i & 3]
+            del tmp
+
+    parallelize(f, n_threads=n_threads)
+
+
+def test18_shard_stats(n_threads=8):
+    s0 = t.shard_stats()
+    count = s0["count"]
+    assert count >= 1 and count & (count - 1) == 0
+    assert len(s0["locks"]) == len(s0["contended"]) == count
+
+    def f():
+        r = [Counter() for _ in range(1000)]
+        for c in r:
+            assert t.return_self(c) is c
+
+    # Locks are only counted while statistics are enabled
+    assert not t.shard_stats_enabled()
+    parallelize(f, n_threads=n_threads)
+    assert t.shard_stats() == s0
+
+    t.set_shard_stats_enabled(True)
+    try:
+        assert t.shard_stats_enabled()
+        parallelize(f, n_threads=n_threads)
+    finally:
+        t.set_shard_stats_enabled(False)
+    s1 = t.shard_stats()
+    assert all(c <= l for l, c in zip(s1["locks"], s1["contended"]))
+
+    if sysconfig.get_config_var("Py_GIL_DISABLED"):
+        # Registering and unregistering the instances locks their shards
+        assert sum(s1["locks"]) >= sum(s0["locks"]) + 2 * 1000 * n_threads
+    else:
+        assert count == 1 and s1["locks"] == [0]
+
+
+@pytest.mark.skipif(not sysconfig.get_config_var("Py_GIL_DISABLED"),
+                    reason="shards are specific to free-threaded builds")
+@pytest.mark.parametrize("value, expected", [("3", 4), ("1", 1), ("auto", None)])
+def test19_shard_count_env(value, expected):
+    # The shard count is chosen when the first extension of a domain loads
+    env = dict(os.environ, NB_SHARD_COUNT=value,
+               PYTHONPATH=os.pathsep.join(p for p in sys.path if p))
+    out = subprocess.check_output(
+        [sys.executable, "-c",
+         "import test_thread_ext as t; print(t.shard_stats()['count'])"],
+        env=env, text=True)
+    count = int(out)
+    if expected is None:
+        cpus = os.process_cpu_count()
+        assert count == min(4096, 1 << (2 * cpus - 1).bit_length())
+    else:
+        assert count == expected
+
+
+def test20_bench_thread():
+    # Smoke test of the throughput benchmark harness (bench_thread.py)
+    import json
+    import bench_thread
+
+    r = bench_thread.run([1, 2], duration=0.01)
+    assert set(r["benchmarks"]) == set(bench_thread.BENCHMARKS)
+    for entry in r["benchmarks"].values():
+        assert set(entry["calls_per_second"]) == {"1", "2"}
+        assert all(v > 0 for v in entry["calls_per_second"].values())
+        assert entry["speedup"]["1"] == 1
+    assert json.loads(json.dumps(r)) == r
+    assert bench_thread.compare(r, r, 0.2) == []